@@ -20,6 +20,7 @@
 #ifdef HITLS_BSL_SAL_NET
 
 #include <stdint.h>
+#include "bsl_uio.h"
 
 #ifdef HITLS_BSL_SAL_LINUX
 #include <arpa/inet.h>
@@ -40,6 +41,13 @@ int32_t SAL_Sendto(int32_t sock, const void *buf, size_t len, int32_t flags, BSL
 int32_t SAL_RecvFrom(int32_t sock, void *buf, size_t len, int32_t flags, BSL_SAL_SockAddr address, int32_t *addrLen,
                      int32_t *err);
 
+/* Kernel TLS: the record protection is offloaded to the socket, and the record type is carried by cmsg */
+int32_t SAL_SetKtls(int32_t fd, const BSL_UIO_KtlsCryptoInfo *info);
+
+int32_t SAL_KtlsWrite(int32_t fd, uint8_t recordType, const void *buf, uint32_t len, int32_t *err);
+
+int32_t SAL_KtlsRead(int32_t fd, void *buf, uint32_t len, uint8_t *recordType, int32_t *err);
+
 int32_t SAL_SockAddrNew(BSL_SAL_SockAddr *sockAddr);
 int32_t SAL_SockAddrGetFamily(const BSL_SAL_SockAddr sockAddr);
 void SAL_SockAddrFree(BSL_SAL_SockAddr sockAddr);
@@ -25,11 +25,25 @@
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <errno.h>
+#include <netinet/tcp.h>
+#include <linux/tls.h>
 #include "securec.h"
 #include "bsl_sal.h"
 #include "bsl_errno.h"
+#include "bsl_bytes.h"
 #include "sal_net.h"
 
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
+#define KTLS_RECORD_TYPE_APP 23u
+#define KTLS_GCM_SALT_LEN 4u
+#define KTLS_EXPLICIT_IV_LEN 8u
+
 typedef union {
     struct sockaddr addr;
     struct sockaddr_in6 addrIn6;
@@ -87,6 +101,163 @@ int32_t SAL_NET_RecvFrom(int32_t sock, void *buf, size_t len, int32_t flags, voi
     return ret;
 }
 
+typedef union {
+    struct tls_crypto_info base;
+    struct tls12_crypto_info_aes_gcm_128 aes128Gcm;
+    struct tls12_crypto_info_aes_gcm_256 aes256Gcm;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    struct tls12_crypto_info_chacha20_poly1305 chacha20Poly1305;
+#endif
+#ifdef TLS_CIPHER_SM4_GCM
+    struct tls12_crypto_info_sm4_gcm sm4Gcm;
+#endif
+} LinuxKtlsCryptoInfo;
+
+/* GCM nonce = salt(4) || explicit part(8). In TLS 1.2 the salt is the implicit IV and the explicit part is sent in
+ * the record, in TLS 1.3 both parts come from the 12-byte IV. */
+static int32_t KtlsSetGcmInfo(const BSL_UIO_KtlsCryptoInfo *info, uint8_t *key, uint32_t keyLen, uint8_t *salt,
+    uint8_t *iv)
+{
+    if (info->keyLen != keyLen) {
+        return BSL_SAL_ERR_BAD_PARAM;
+    }
+    (void)memcpy_s(key, keyLen, info->key, info->keyLen);
+    if (info->ivLen == KTLS_GCM_SALT_LEN) {
+        (void)memcpy_s(salt, KTLS_GCM_SALT_LEN, info->iv, KTLS_GCM_SALT_LEN);
+        BSL_Uint64ToByte(info->seq, iv);
+        return BSL_SUCCESS;
+    }
+    if (info->ivLen == KTLS_GCM_SALT_LEN + KTLS_EXPLICIT_IV_LEN) {
+        (void)memcpy_s(salt, KTLS_GCM_SALT_LEN, info->iv, KTLS_GCM_SALT_LEN);
+        (void)memcpy_s(iv, KTLS_EXPLICIT_IV_LEN, info->iv + KTLS_GCM_SALT_LEN, KTLS_EXPLICIT_IV_LEN);
+        return BSL_SUCCESS;
+    }
+    return BSL_SAL_ERR_BAD_PARAM;
+}
+
+static int32_t KtlsSetCryptoInfo(const BSL_UIO_KtlsCryptoInfo *info, LinuxKtlsCryptoInfo *cryptoInfo, uint32_t *len)
+{
+    int32_t ret = BSL_SAL_ERR_BAD_PARAM;
+    uint8_t *recSeq = NULL;
+    switch (info->cipher) {
+        case BSL_UIO_KTLS_AES_128_GCM:
+            cryptoInfo->base.cipher_type = TLS_CIPHER_AES_GCM_128;
+            ret = KtlsSetGcmInfo(info, cryptoInfo->aes128Gcm.key, sizeof(cryptoInfo->aes128Gcm.key),
+                cryptoInfo->aes128Gcm.salt, cryptoInfo->aes128Gcm.iv);
+            recSeq = cryptoInfo->aes128Gcm.rec_seq;
+            *len = sizeof(cryptoInfo->aes128Gcm);
+            break;
+        case BSL_UIO_KTLS_AES_256_GCM:
+            cryptoInfo->base.cipher_type = TLS_CIPHER_AES_GCM_256;
+            ret = KtlsSetGcmInfo(info, cryptoInfo->aes256Gcm.key, sizeof(cryptoInfo->aes256Gcm.key),
+                cryptoInfo->aes256Gcm.salt, cryptoInfo->aes256Gcm.iv);
+            recSeq = cryptoInfo->aes256Gcm.rec_seq;
+            *len = sizeof(cryptoInfo->aes256Gcm);
+            break;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+        case BSL_UIO_KTLS_CHACHA20_POLY1305:
+            /* The nonce is the 12-byte IV XORed with the sequence number, there is no explicit part */
+            if (info->keyLen != sizeof(cryptoInfo->chacha20Poly1305.key) ||
+                info->ivLen != sizeof(cryptoInfo->chacha20Poly1305.iv)) {
+                return BSL_SAL_ERR_BAD_PARAM;
+            }
+            cryptoInfo->base.cipher_type = TLS_CIPHER_CHACHA20_POLY1305;
+            (void)memcpy_s(cryptoInfo->chacha20Poly1305.key, sizeof(cryptoInfo->chacha20Poly1305.key),
+                info->key, info->keyLen);
+            (void)memcpy_s(cryptoInfo->chacha20Poly1305.iv, sizeof(cryptoInfo->chacha20Poly1305.iv),
+                info->iv, info->ivLen);
+            ret = BSL_SUCCESS;
+            recSeq = cryptoInfo->chacha20Poly1305.rec_seq;
+            *len = sizeof(cryptoInfo->chacha20Poly1305);
+            break;
+#endif
+#ifdef TLS_CIPHER_SM4_GCM
+        case BSL_UIO_KTLS_SM4_GCM:
+            cryptoInfo->base.cipher_type = TLS_CIPHER_SM4_GCM;
+            ret = KtlsSetGcmInfo(info, cryptoInfo->sm4Gcm.key, sizeof(cryptoInfo->sm4Gcm.key),
+                cryptoInfo->sm4Gcm.salt, cryptoInfo->sm4Gcm.iv);
+            recSeq = cryptoInfo->sm4Gcm.rec_seq;
+            *len = sizeof(cryptoInfo->sm4Gcm);
+            break;
+#endif
+        default:
+            break;
+    }
+    if (ret != BSL_SUCCESS) {
+        return ret;
+    }
+    cryptoInfo->base.version = info->version;
+    BSL_Uint64ToByte(info->seq, recSeq);
+    return BSL_SUCCESS;
+}
+
+int32_t SAL_NET_SetKtls(int32_t fd, const BSL_UIO_KtlsCryptoInfo *info)
+{
+    LinuxKtlsCryptoInfo cryptoInfo;
+    (void)memset_s(&cryptoInfo, sizeof(cryptoInfo), 0, sizeof(cryptoInfo));
+    uint32_t len = 0;
+    int32_t ret = KtlsSetCryptoInfo(info, &cryptoInfo, &len);
+    if (ret != BSL_SUCCESS) {
+        return ret;
+    }
+    /* The TLS ULP is attached once per socket, it already exists when the second direction or a new key is set */
+    if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0 && errno != EEXIST) {
+        BSL_SAL_CleanseData(&cryptoInfo, sizeof(cryptoInfo));
+        return BSL_SAL_ERR_NET_SETSOCKOPT;
+    }
+    ret = setsockopt(fd, SOL_TLS, info->isSend ? TLS_TX : TLS_RX, &cryptoInfo, (socklen_t)len);
+    BSL_SAL_CleanseData(&cryptoInfo, sizeof(cryptoInfo));
+    return (ret == 0) ? BSL_SUCCESS : BSL_SAL_ERR_NET_SETSOCKOPT;
+}
+
+int32_t SAL_NET_KtlsWrite(int32_t fd, uint8_t recordType, const void *buf, uint32_t len, int32_t *err)
+{
+    if (recordType == KTLS_RECORD_TYPE_APP) {
+        return SAL_NET_Write(fd, buf, len, err);
+    }
+    /* Records of other types are sent with the type in the control message */
+    uint8_t control[CMSG_SPACE(sizeof(recordType))] = {0};
+    struct iovec iov = { (void *)(uintptr_t)buf, len };
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(recordType));
+    *CMSG_DATA(cmsg) = recordType;
+    int32_t ret = (int32_t)sendmsg(fd, &msg, 0);
+    if (ret < 0) {
+        *err = errno;
+    }
+    return ret;
+}
+
+int32_t SAL_NET_KtlsRead(int32_t fd, void *buf, uint32_t len, uint8_t *recordType, int32_t *err)
+{
+    uint8_t control[CMSG_SPACE(sizeof(uint8_t))] = {0};
+    struct iovec iov = { buf, len };
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    int32_t ret = (int32_t)recvmsg(fd, &msg, 0);
+    if (ret < 0) {
+        *err = errno;
+        return ret;
+    }
+    /* The kernel reports the type of records other than application data, and never mixes types in one read */
+    *recordType = KTLS_RECORD_TYPE_APP;
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg != NULL && cmsg->cmsg_level == SOL_TLS && cmsg->cmsg_type == TLS_GET_RECORD_TYPE) {
+        *recordType = *CMSG_DATA(cmsg);
+    }
+    return ret;
+}
+
 int32_t SAL_NET_SockAddrNew(BSL_SAL_SockAddr *sockAddr)
 {
     LinuxSockAddr *addr = (LinuxSockAddr *)BSL_SAL_Calloc(1, sizeof(LinuxSockAddr));
@@ -63,6 +63,46 @@ int32_t SAL_Read(int32_t fd, void *buf, uint32_t len, int32_t *err)
 #endif
 }
 
+int32_t SAL_SetKtls(int32_t fd, const BSL_UIO_KtlsCryptoInfo *info)
+{
+    if (info == NULL || info->key == NULL || info->iv == NULL) {
+        return BSL_SAL_ERR_BAD_PARAM;
+    }
+#ifdef HITLS_BSL_SAL_LINUX
+    return SAL_NET_SetKtls(fd, info);
+#else
+    (void)fd;
+    return BSL_SAL_NET_NO_REG_FUNC;
+#endif
+}
+
+int32_t SAL_KtlsWrite(int32_t fd, uint8_t recordType, const void *buf, uint32_t len, int32_t *err)
+{
+    if (buf == NULL || len == 0 || err == NULL) {
+        return BSL_SAL_ERR_BAD_PARAM;
+    }
+#ifdef HITLS_BSL_SAL_LINUX
+    return SAL_NET_KtlsWrite(fd, recordType, buf, len, err);
+#else
+    (void)fd;
+    (void)recordType;
+    return BSL_SAL_NET_NO_REG_FUNC;
+#endif
+}
+
+int32_t SAL_KtlsRead(int32_t fd, void *buf, uint32_t len, uint8_t *recordType, int32_t *err)
+{
+    if (buf == NULL || len == 0 || recordType == NULL || err == NULL) {
+        return BSL_SAL_ERR_BAD_PARAM;
+    }
+#ifdef HITLS_BSL_SAL_LINUX
+    return SAL_NET_KtlsRead(fd, buf, len, recordType, err);
+#else
+    (void)fd;
+    return BSL_SAL_NET_NO_REG_FUNC;
+#endif
+}
+
 int32_t SAL_Sendto(int32_t sock, const void *buf, size_t len, int32_t flags, BSL_SAL_SockAddr address,
                    int32_t addrLen, int32_t *err)
 {
@@ -21,6 +21,7 @@
 
 #include <stdint.h>
 #include "bsl_sal.h"
+#include "bsl_uio.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -55,6 +56,9 @@ int32_t SAL_NetCallback_Ctrl(BSL_SAL_CB_FUNC_TYPE type, void *funcCb);
 #ifdef HITLS_BSL_SAL_LINUX
 int32_t SAL_NET_Write(int32_t fd, const void *buf, uint32_t len, int32_t *err);
 int32_t SAL_NET_Read(int32_t fd, void *buf, uint32_t len, int32_t *err);
+int32_t SAL_NET_SetKtls(int32_t fd, const BSL_UIO_KtlsCryptoInfo *info);
+int32_t SAL_NET_KtlsWrite(int32_t fd, uint8_t recordType, const void *buf, uint32_t len, int32_t *err);
+int32_t SAL_NET_KtlsRead(int32_t fd, void *buf, uint32_t len, uint8_t *recordType, int32_t *err);
 int32_t SAL_NET_SockAddrNew(BSL_SAL_SockAddr *sockAddr);
 void SAL_NET_SockAddrFree(BSL_SAL_SockAddr sockAddr);
 int32_t SAL_NET_SockAddrGetFamily(const BSL_SAL_SockAddr sockAddr);
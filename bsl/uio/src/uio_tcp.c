@@ -25,8 +25,14 @@
 #include "uio_base.h"
 #include "uio_abstraction.h"
 
+#define TCP_KTLS_RECORD_TYPE_APP 23u
+
 typedef struct {
     int32_t fd;
+    bool isKtlsSend;            /* The records to be sent are protected by the kernel */
+    bool isKtlsRecv;            /* The records received are verified by the kernel */
+    uint8_t sendRecordType;     /* Type of the records built by the kernel for the data written */
+    uint8_t recvRecordType;     /* Type of the record the data of the last read comes from */
 } TcpPrameters;
 
 static int32_t TcpNew(BSL_UIO *uio)
@@ -47,6 +53,8 @@ static int32_t TcpNew(BSL_UIO *uio)
     }
 
     parameters->fd = -1;
+    parameters->sendRecordType = TCP_KTLS_RECORD_TYPE_APP;
+    parameters->recvRecordType = TCP_KTLS_RECORD_TYPE_APP;
     uio->ctx = parameters;
     uio->ctxLen = sizeof(TcpPrameters);
     // Specifies whether to be closed by uio when setting fd.
@@ -80,7 +88,9 @@ static int32_t TcpSocketWrite(BSL_UIO *uio, const void *buf, uint32_t len, uint3
         BSL_ERR_PUSH_ERROR(BSL_UIO_IO_EXCEPTION);
         return BSL_UIO_IO_EXCEPTION;
     }
-    int32_t ret = SAL_Write(fd, buf, len, &err);
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    int32_t ret = (ctx != NULL && ctx->isKtlsSend) ? SAL_KtlsWrite(fd, ctx->sendRecordType, buf, len, &err) :
+        SAL_Write(fd, buf, len, &err);
     (void)BSL_UIO_ClearFlags(uio, BSL_UIO_FLAGS_RWS | BSL_UIO_FLAGS_SHOULD_RETRY);
     if (ret > 0) {
         *writeLen = (uint32_t)ret;
@@ -106,7 +116,9 @@ static int32_t TcpSocketRead(BSL_UIO *uio, void *buf, uint32_t len, uint32_t *re
         BSL_ERR_PUSH_ERROR(BSL_UIO_IO_EXCEPTION);
         return BSL_UIO_IO_EXCEPTION;
     }
-    int32_t ret = SAL_Read(fd, buf, len, &err);
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    int32_t ret = (ctx != NULL && ctx->isKtlsRecv) ? SAL_KtlsRead(fd, buf, len, &ctx->recvRecordType, &err) :
+        SAL_Read(fd, buf, len, &err);
     if (ret > 0) { // Success
         *readLen = (uint32_t)ret;
         return BSL_SUCCESS;
@@ -170,6 +182,60 @@ static int32_t TcpGetFd(BSL_UIO *uio, int32_t size, int32_t *fd)
     return BSL_SUCCESS;
 }
 
+static int32_t TcpSetKtls(BSL_UIO *uio, int32_t size, const BSL_UIO_KtlsCryptoInfo *info)
+{
+    if (info == NULL || info->key == NULL || info->iv == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_NULL_INPUT);
+        return BSL_NULL_INPUT;
+    }
+    if (size != (int32_t)sizeof(*info)) {
+        BSL_ERR_PUSH_ERROR(BSL_INVALID_ARG);
+        return BSL_INVALID_ARG;
+    }
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    if (ctx == NULL || ctx->fd < 0) {
+        BSL_ERR_PUSH_ERROR(BSL_UIO_FAIL);
+        return BSL_UIO_FAIL;
+    }
+    int32_t ret = SAL_SetKtls(ctx->fd, info);
+    if (ret != BSL_SUCCESS) {
+        /* Not fatal: the caller keeps protecting the records in user space */
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID05084, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+            "Uio: kernel tls is not available, ret = %d.", ret, 0, 0, 0);
+        BSL_ERR_PUSH_ERROR(BSL_UIO_FAIL);
+        return BSL_UIO_FAIL;
+    }
+    if (info->isSend) {
+        ctx->isKtlsSend = true;
+    } else {
+        ctx->isKtlsRecv = true;
+    }
+    return BSL_SUCCESS;
+}
+
+static int32_t TcpKtlsRecordType(BSL_UIO *uio, int32_t cmd, int32_t size, uint8_t *type)
+{
+    if (type == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_NULL_INPUT);
+        return BSL_NULL_INPUT;
+    }
+    if (size != (int32_t)sizeof(*type)) {
+        BSL_ERR_PUSH_ERROR(BSL_INVALID_ARG);
+        return BSL_INVALID_ARG;
+    }
+    TcpPrameters *ctx = BSL_UIO_GetCtx(uio);
+    if (ctx == NULL) {
+        BSL_ERR_PUSH_ERROR(BSL_NULL_INPUT);
+        return BSL_NULL_INPUT;
+    }
+    if (cmd == BSL_UIO_TCP_SET_KTLS_RECORD_TYPE) {
+        ctx->sendRecordType = *type;
+    } else {
+        *type = ctx->recvRecordType;
+    }
+    return BSL_SUCCESS;
+}
+
 static int32_t TcpSocketCtrl(BSL_UIO *uio, int32_t cmd, int32_t larg, void *parg)
 {
     switch (cmd) {
@@ -179,6 +245,11 @@ static int32_t TcpSocketCtrl(BSL_UIO *uio, int32_t cmd, int32_t larg, void *parg
             return TcpGetFd(uio, larg, parg);
         case BSL_UIO_FLUSH:
             return BSL_SUCCESS;
+        case BSL_UIO_TCP_SET_KTLS:
+            return TcpSetKtls(uio, larg, parg);
+        case BSL_UIO_TCP_SET_KTLS_RECORD_TYPE:
+        case BSL_UIO_TCP_GET_KTLS_RECORD_TYPE:
+            return TcpKtlsRecordType(uio, cmd, larg, parg);
         default:
             break;
     }
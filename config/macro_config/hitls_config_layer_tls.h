@@ -187,6 +187,12 @@
     #ifndef HITLS_TLS_FEATURE_MAX_SEND_FRAGMENT
         #define HITLS_TLS_FEATURE_MAX_SEND_FRAGMENT
     #endif
+    #ifndef HITLS_TLS_FEATURE_KTLS
+        #define HITLS_TLS_FEATURE_KTLS
+    #endif
+    #ifndef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        #define HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+    #endif
 #endif /* HITLS_TLS_FEATURE */
 
 #ifdef HITLS_TLS_FEATURE_SESSION
@@ -25,6 +25,7 @@
 #include "eal_cipher_local.h"
 #include "eal_common.h"
 #include "crypt_utils.h"
+#include "bsl_bytes.h"
 #include "crypt_ealinit.h"
 #include "crypt_types.h"
 #ifdef HITLS_CRYPTO_PROVIDER
@@ -40,6 +41,7 @@ static void CipherCopyMethod(const EAL_CipherMethod *modeMethod, EAL_CipherUnita
     method->final = modeMethod->final;
     method->ctrl = modeMethod->ctrl;
     method->freeCtx = modeMethod->freeCtx;
+    method->aead = modeMethod->aead;
 }
 
 static CRYPT_EAL_CipherCtx *CipherNewDefaultCtx(CRYPT_CIPHER_AlgId id)
@@ -115,6 +117,9 @@ static int32_t CRYPT_EAL_SetCipherMethod(CRYPT_EAL_CipherCtx *ctx, const CRYPT_E
             case CRYPT_EAL_IMPLCIPHER_CTRL:
                 method->ctrl = funcs[index].func;
                 break;
+            case CRYPT_EAL_IMPLCIPHER_AEAD:
+                method->aead = funcs[index].func;
+                break;
             default:
                 BSL_SAL_FREE(method);
                 BSL_ERR_PUSH_ERROR(CRYPT_PROVIDER_ERR_UNEXPECTED_IMPL);
@@ -539,4 +544,171 @@ int32_t CRYPT_EAL_CipherGetInfo(CRYPT_CIPHER_AlgId id, int32_t type, uint32_t *i
     return CRYPT_SUCCESS;
 }
 
+#define AEAD_MAX_TAG_LEN 16
+
+static int32_t CheckAeadParam(const CRYPT_EAL_CipherCtx *ctx, const CRYPT_ConstData *nonce,
+    const CRYPT_ConstData *in, const uint8_t *out, const uint8_t *tag)
+{
+    if (ctx == NULL || nonce == NULL || in == NULL || tag == NULL ||
+        (in->len != 0 && (in->data == NULL || out == NULL))) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    if (in->len != 0 && IsPartialOverLap(out, in->data, in->len)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_EAL_ERR_PART_OVERLAP);
+        return CRYPT_EAL_ERR_PART_OVERLAP;
+    }
+    // The key is set by init, the one-shot interface only replaces the nonce.
+    if (ctx->states == EAL_CIPHER_STATE_NEW) {
+        BSL_ERR_PUSH_ERROR(CRYPT_EAL_ERR_STATE);
+        return CRYPT_EAL_ERR_STATE;
+    }
+    if (ctx->method == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_EAL_ALG_NOT_SUPPORT);
+        return CRYPT_EAL_ALG_NOT_SUPPORT;
+    }
+    if (ctx->method->aead == NULL &&
+        (ctx->method->ctrl == NULL || ctx->method->update == NULL || !IsAeadAlg(ctx->id))) {
+        BSL_ERR_PUSH_ERROR(CRYPT_EAL_ALG_NOT_SUPPORT);
+        return CRYPT_EAL_ALG_NOT_SUPPORT;
+    }
+    return CRYPT_SUCCESS;
+}
+
+// Used by the providers which do not implement the one-shot interface.
+static int32_t CipherAeadByCtrl(CRYPT_EAL_CipherCtx *ctx, bool enc, const CRYPT_ConstData *nonce,
+    const CRYPT_ConstData *aad, const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen)
+{
+    const EAL_CipherUnitaryMethod *method = ctx->method;
+    int32_t ret = method->ctrl(ctx->ctx, CRYPT_CTRL_REINIT_STATUS, (void *)(uintptr_t)nonce->data, nonce->len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    if (ctx->id != CRYPT_CIPHER_CHACHA20_POLY1305) {
+        ret = method->ctrl(ctx->ctx, CRYPT_CTRL_SET_TAGLEN, &tagLen, sizeof(tagLen));
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+    }
+    if (ctx->id == CRYPT_CIPHER_AES128_CCM || ctx->id == CRYPT_CIPHER_AES192_CCM ||
+        ctx->id == CRYPT_CIPHER_AES256_CCM) {
+        uint64_t msgLen = in->len;
+        ret = method->ctrl(ctx->ctx, CRYPT_CTRL_SET_MSGLEN, &msgLen, sizeof(msgLen));
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+    }
+    ret = method->ctrl(ctx->ctx, CRYPT_CTRL_SET_AAD, (void *)(uintptr_t)aad->data, aad->len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    if (in->len != 0) {
+        uint32_t outLen = in->len;
+        ret = method->update(ctx->ctx, in->data, in->len, out, &outLen);
+        if (ret != CRYPT_SUCCESS) {
+            return ret;
+        }
+    }
+    if (enc) {
+        return method->ctrl(ctx->ctx, CRYPT_CTRL_GET_TAG, tag, tagLen);
+    }
+    uint8_t expectTag[AEAD_MAX_TAG_LEN];
+    if (tagLen > sizeof(expectTag)) {
+        BSL_ERR_PUSH_ERROR(CRYPT_MODES_TAGLEN_ERROR);
+        return CRYPT_MODES_TAGLEN_ERROR;
+    }
+    ret = method->ctrl(ctx->ctx, CRYPT_CTRL_GET_TAG, expectTag, tagLen);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    if (ConstTimeMemcmp(tag, expectTag, tagLen) == 0) {
+        BSL_SAL_CleanseData(out, in->len);
+        BSL_ERR_PUSH_ERROR(CRYPT_MODES_TAG_VERIFY_FAIL);
+        return CRYPT_MODES_TAG_VERIFY_FAIL;
+    }
+    return CRYPT_SUCCESS;
+}
+
+static int32_t CipherAeadProcess(CRYPT_EAL_CipherCtx *ctx, bool enc, const CRYPT_ConstData *nonce,
+    const CRYPT_ConstData *aad, const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen)
+{
+    int32_t ret = CheckAeadParam(ctx, nonce, in, out, tag);
+    if (ret != CRYPT_SUCCESS) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_CIPHER, (ctx == NULL) ? CRYPT_CIPHER_MAX : ctx->id, ret);
+        return ret;
+    }
+    const CRYPT_ConstData noAad = {NULL, 0};
+    const CRYPT_ConstData *realAad = (aad == NULL) ? &noAad : aad;
+    if (ctx->method->aead != NULL) {
+        ret = ctx->method->aead(ctx->ctx, enc, nonce, realAad, in, out, tag, tagLen);
+    } else {
+        ret = CipherAeadByCtrl(ctx, enc, nonce, realAad, in, out, tag, tagLen);
+    }
+    // A new message must be started with a nonce, as after getting the tag.
+    ctx->states = EAL_CIPHER_STATE_FINAL;
+    if (ret != CRYPT_SUCCESS) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_CIPHER, ctx->id, ret);
+    }
+    return ret;
+}
+
+int32_t CRYPT_EAL_CipherAeadSeal(CRYPT_EAL_CipherCtx *ctx, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, CRYPT_Data *tag)
+{
+    if (tag == NULL) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_CIPHER, (ctx == NULL) ? CRYPT_CIPHER_MAX : ctx->id,
+            CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    return CipherAeadProcess(ctx, true, nonce, aad, in, out, tag->data, tag->len);
+}
+
+int32_t CRYPT_EAL_CipherAeadOpen(CRYPT_EAL_CipherCtx *ctx, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, const CRYPT_ConstData *tag)
+{
+    if (tag == NULL) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_CIPHER, (ctx == NULL) ? CRYPT_CIPHER_MAX : ctx->id,
+            CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    return CipherAeadProcess(ctx, false, nonce, aad, in, out, (uint8_t *)(uintptr_t)tag->data, tag->len);
+}
+
+int32_t CRYPT_EAL_CipherAeadSealBatch(CRYPT_EAL_CipherCtx *ctx, CRYPT_EAL_AeadRecord *records, uint32_t num)
+{
+    if (records == NULL || num == 0) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_CIPHER, (ctx == NULL) ? CRYPT_CIPHER_MAX : ctx->id,
+            CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    int32_t ret;
+    // Check all the messages first, so that the loop below only runs the algorithm.
+    for (uint32_t i = 0; i < num; i++) {
+        ret = CheckAeadParam(ctx, &records[i].nonce, &records[i].in, records[i].out, records[i].tag.data);
+        if (ret != CRYPT_SUCCESS) {
+            EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_CIPHER, (ctx == NULL) ? CRYPT_CIPHER_MAX : ctx->id, ret);
+            return ret;
+        }
+    }
+    CipherAead aead = ctx->method->aead;
+    for (uint32_t i = 0; i < num; i++) {
+        CRYPT_EAL_AeadRecord *rec = &records[i];
+        if (aead != NULL) {
+            ret = aead(ctx->ctx, true, &rec->nonce, &rec->aad, &rec->in, rec->out, rec->tag.data, rec->tag.len);
+        } else {
+            ret = CipherAeadByCtrl(ctx, true, &rec->nonce, &rec->aad, &rec->in, rec->out, rec->tag.data,
+                rec->tag.len);
+        }
+        if (ret != CRYPT_SUCCESS) {
+            break;
+        }
+    }
+    ctx->states = EAL_CIPHER_STATE_FINAL;
+    if (ret != CRYPT_SUCCESS) {
+        EAL_ERR_REPORT(CRYPT_EVENT_ERR, CRYPT_ALGO_CIPHER, ctx->id, ret);
+    }
+    return ret;
+}
+
 #endif
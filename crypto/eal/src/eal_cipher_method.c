@@ -69,7 +69,8 @@ static const EAL_CipherMethod CHACHA20_POLY1305_METHOD = {
     (CipherUpdate)MODES_CHACHA20POLY1305_Update,
     (CipherFinal)MODES_CHACHA20POLY1305_Final,
     (CipherCtrl)MODES_CHACHA20POLY1305_Ctrl,
-    (CipherFreeCtx)MODES_CHACHA20POLY1305_FreeCtx
+    (CipherFreeCtx)MODES_CHACHA20POLY1305_FreeCtx,
+    (CipherAead)MODES_CHACHA20POLY1305_Aead
 };
 #endif
 
@@ -81,7 +82,8 @@ static const EAL_CipherMethod CTR_METHOD = {
     (CipherUpdate)MODES_CTR_UpdateEx,
     (CipherFinal)MODES_CTR_Final,
     (CipherCtrl)MODES_CTR_Ctrl,
-    (CipherFreeCtx)MODES_CTR_FreeCtx
+    (CipherFreeCtx)MODES_CTR_FreeCtx,
+    NULL
 };
 #endif
 
@@ -93,7 +95,8 @@ static const EAL_CipherMethod CBC_METHOD = {
     (CipherUpdate)MODES_CBC_UpdateEx,
     (CipherFinal)MODES_CBC_FinalEx,
     (CipherCtrl)MODES_CBC_Ctrl,
-    (CipherFreeCtx)MODES_CBC_FreeCtx
+    (CipherFreeCtx)MODES_CBC_FreeCtx,
+    NULL
 };
 #endif
 
@@ -105,7 +108,8 @@ static const EAL_CipherMethod ECB_METHOD = {
     (CipherUpdate)MODES_ECB_UpdateEx,
     (CipherFinal)MODES_ECB_FinalEx,
     (CipherCtrl)MODES_ECB_Ctrl,
-    (CipherFreeCtx)MODES_ECB_FreeCtx
+    (CipherFreeCtx)MODES_ECB_FreeCtx,
+    NULL
 };
 #endif
 
@@ -117,7 +121,8 @@ static const EAL_CipherMethod CCM_METHOD = {
     (CipherUpdate)MODES_CCM_UpdateEx,
     (CipherFinal)MODES_CCM_Final,
     (CipherCtrl)MODES_CCM_Ctrl,
-    (CipherFreeCtx)MODES_CCM_FreeCtx
+    (CipherFreeCtx)MODES_CCM_FreeCtx,
+    (CipherAead)MODES_CCM_Aead
 };
 #endif
 
@@ -129,7 +134,8 @@ static const EAL_CipherMethod GCM_METHOD = {
     (CipherUpdate)MODES_GCM_UpdateEx,
     (CipherFinal)MODES_GCM_Final,
     (CipherCtrl)MODES_GCM_Ctrl,
-    (CipherFreeCtx)MODES_GCM_FreeCtx
+    (CipherFreeCtx)MODES_GCM_FreeCtx,
+    (CipherAead)MODES_GCM_Aead
 };
 #endif
 
@@ -142,7 +148,8 @@ static const EAL_CipherMethod CFB_METHOD = {
     (CipherUpdate)MODES_CFB_UpdateEx,
     (CipherFinal)MODES_CFB_Final,
     (CipherCtrl)MODES_CFB_Ctrl,
-    (CipherFreeCtx)MODES_CFB_FreeCtx
+    (CipherFreeCtx)MODES_CFB_FreeCtx,
+    NULL
 };
 #endif
 
@@ -154,7 +161,8 @@ static const EAL_CipherMethod OFB_METHOD = {
     (CipherUpdate)MODES_OFB_UpdateEx,
     (CipherFinal)MODES_OFB_Final,
     (CipherCtrl)MODES_OFB_Ctrl,
-    (CipherFreeCtx)MODES_OFB_FreeCtx
+    (CipherFreeCtx)MODES_OFB_FreeCtx,
+    NULL
 };
 #endif
 
@@ -166,7 +174,8 @@ static const EAL_CipherMethod XTS_METHOD = {
     (CipherUpdate)MODES_XTS_UpdateEx,
     (CipherFinal)MODES_XTS_Final,
     (CipherCtrl)MODES_XTS_Ctrl,
-    (CipherFreeCtx)MODES_XTS_FreeCtx
+    (CipherFreeCtx)MODES_XTS_FreeCtx,
+    NULL
 };
 #endif
 
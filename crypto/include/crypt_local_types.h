@@ -228,6 +228,9 @@ typedef int32_t (*CipherUpdate)(void *ctx, const uint8_t *in, uint32_t inLen, ui
 typedef int32_t (*CipherFinal)(void *ctx, uint8_t *out, uint32_t *outLen);
 typedef int32_t (*CipherCtrl)(void *ctx, int32_t opt, void *val, uint32_t len);
 typedef void (*CipherFreeCtx)(void *ctx);
+/* One-shot AEAD: enc is true to seal and write the tag, false to open and verify the tag */
+typedef int32_t (*CipherAead)(void *ctx, bool enc, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen);
 
 typedef int32_t (*SetEncryptKey)(void *ctx, const uint8_t *key, uint32_t len);
 typedef int32_t (*SetDecryptKey)(void *ctx, const uint8_t *key, uint32_t len);
@@ -258,6 +261,7 @@ typedef struct {
     CipherFinal final;
     CipherCtrl ctrl;
     CipherFreeCtx freeCtx;
+    CipherAead aead;
 } EAL_CipherMethod;
 
 typedef struct {
@@ -269,6 +273,7 @@ typedef struct {
     CipherFinal final;
     CipherCtrl ctrl;
     CipherFreeCtx freeCtx;
+    CipherAead aead;
 } EAL_CipherUnitaryMethod;
 
 /* prototype of MAC algorithm operation functions */
@@ -61,6 +61,10 @@ int32_t AES_CCM_Update(MODES_CCM_Ctx *modeCtx, const uint8_t *in, uint32_t inLen
 
 int32_t MODES_CCM_UpdateEx(MODES_CCM_Ctx *modeCtx, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen);
 
+// One-shot seal (enc is true) or open of a message, the tag is verified in constant time when opening
+int32_t MODES_CCM_Aead(MODES_CCM_Ctx *modeCtx, bool enc, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -60,6 +60,10 @@ int32_t MODES_CHACHA20POLY1305_DeInitCtx(MODES_CHACHAPOLY_Ctx *modeCtx);
 int32_t MODES_CHACHA20POLY1305_Ctrl(MODES_CHACHAPOLY_Ctx *modeCtx, int32_t cmd, void *val, uint32_t len);
 void MODES_CHACHA20POLY1305_FreeCtx(MODES_CHACHAPOLY_Ctx *modeCtx);
 
+// One-shot seal (enc is true) or open of a message, the tag is verified in constant time when opening
+int32_t MODES_CHACHA20POLY1305_Aead(MODES_CHACHAPOLY_Ctx *modeCtx, bool enc, const CRYPT_ConstData *nonce,
+    const CRYPT_ConstData *aad, const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
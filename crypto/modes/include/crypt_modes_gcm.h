@@ -79,6 +79,10 @@ int32_t MODES_GCM_InitCtxEx(MODES_GCM_Ctx *modeCtx, const uint8_t *key, uint32_t
 
 int32_t MODES_GCM_UpdateEx(MODES_GCM_Ctx *modeCtx, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen);
 
+// One-shot seal (enc is true) or open of a message, the tag is verified in constant time when opening
+int32_t MODES_GCM_Aead(MODES_GCM_Ctx *modeCtx, bool enc, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen);
+
 int32_t MODES_GCM_InitHashTable(MODES_CipherGCMCtx *ctx);
 int32_t MODES_GCM_SetKey(MODES_CipherGCMCtx *ctx, const uint8_t *key, uint32_t len);
 #ifdef __cplusplus
@@ -20,6 +20,7 @@
 #include "bsl_sal.h"
 #include "bsl_err_internal.h"
 #include "crypt_errno.h"
+#include "bsl_bytes.h"
 #include "modes_local.h"
 #ifdef HITLS_CRYPTO_CTR
 #include "crypt_modes_ctr.h"
@@ -539,6 +540,18 @@ int32_t MODES_CipherStreamProcess(void *processFuncs, void *ctx, const uint8_t *
     return CRYPT_SUCCESS;
 }
 
+int32_t MODES_AeadCheckTag(const uint8_t *tag, const uint8_t *expectTag, uint32_t tagLen, uint8_t *out,
+    uint32_t outLen)
+{
+    if (ConstTimeMemcmp((uint8_t *)(uintptr_t)tag, (uint8_t *)(uintptr_t)expectTag, tagLen) == 0) {
+        // The plaintext of a forged ciphertext is not released.
+        BSL_SAL_CleanseData(out, outLen);
+        BSL_ERR_PUSH_ERROR(CRYPT_MODES_TAG_VERIFY_FAIL);
+        return CRYPT_MODES_TAG_VERIFY_FAIL;
+    }
+    return CRYPT_SUCCESS;
+}
+
 // Note that CRYPT_PADDING_ZEROS cannot restore the plaintext length.
 // If uses it, need to maintain the length themselves
 int32_t MODES_SetPaddingCheck(int32_t pad)
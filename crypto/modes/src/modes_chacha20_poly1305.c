@@ -437,4 +437,38 @@ void MODES_CHACHA20POLY1305_FreeCtx(MODES_CHACHAPOLY_Ctx *modeCtx)
     BSL_SAL_ClearFree(modeCtx, sizeof(MODES_CHACHAPOLY_Ctx));
 }
 
+int32_t MODES_CHACHA20POLY1305_Aead(MODES_CHACHAPOLY_Ctx *modeCtx, bool enc, const CRYPT_ConstData *nonce,
+    const CRYPT_ConstData *aad, const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen)
+{
+    // The parameters have been checked at the EAL layer and will not be checked again here.
+    if (modeCtx == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    MODES_CipherChaChaPolyCtx *ctx = &modeCtx->chachaCtx;
+    int32_t ret = SetIv(ctx, nonce->data, nonce->len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    ret = SetAad(ctx, aad->data, aad->len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    modeCtx->enc = enc;
+    uint32_t outLen = in->len;
+    ret = MODES_CHACHA20POLY1305_Update(modeCtx, in->data, in->len, out, &outLen);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    if (enc) {
+        return GetTag(ctx, tag, tagLen);
+    }
+    uint8_t expectTag[POLY1305_TAGSIZE];
+    ret = GetTag(ctx, expectTag, tagLen);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    return MODES_AeadCheckTag(tag, expectTag, tagLen, out, in->len);
+}
+
 #endif
\ No newline at end of file
@@ -559,4 +559,42 @@ int32_t MODES_GCM_UpdateEx(MODES_GCM_Ctx *modeCtx, const uint8_t *in, uint32_t i
     }
 }
 
+int32_t MODES_GCM_Aead(MODES_GCM_Ctx *modeCtx, bool enc, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen)
+{
+    // The parameters have been checked at the EAL layer and will not be checked again here.
+    if (modeCtx == NULL) {
+        BSL_ERR_PUSH_ERROR(CRYPT_NULL_INPUT);
+        return CRYPT_NULL_INPUT;
+    }
+    MODES_CipherGCMCtx *ctx = &modeCtx->gcmCtx;
+    int32_t ret = MODES_GCM_SetIv(ctx, nonce->data, nonce->len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    ret = SetTagLen(ctx, (const uint8_t *)&tagLen, sizeof(tagLen));
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    ret = SetAad(ctx, aad->data, aad->len);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    modeCtx->enc = enc;
+    uint32_t outLen = in->len;
+    ret = MODES_GCM_UpdateEx(modeCtx, in->data, in->len, out, &outLen);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    if (enc) {
+        return GetTag(ctx, tag, tagLen);
+    }
+    uint8_t expectTag[GCM_BLOCKSIZE];
+    ret = GetTag(ctx, expectTag, tagLen);
+    if (ret != CRYPT_SUCCESS) {
+        return ret;
+    }
+    return MODES_AeadCheckTag(tag, expectTag, tagLen, out, in->len);
+}
+
 #endif
\ No newline at end of file
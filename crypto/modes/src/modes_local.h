@@ -74,6 +74,16 @@ int32_t MODES_CipherCtrl(MODES_CipherCtx *ctx, int32_t opt, void *val, uint32_t
 int32_t MODES_CipherStreamProcess(void *processFuncs, void *ctx, const uint8_t *in, uint32_t inLen,
     uint8_t *out, uint32_t *outLen);
 
+/**
+ * @brief Compare the tag of an AEAD ciphertext with the calculated one in constant time.
+ *        If they are different, the decrypted data is cleared.
+ *
+ * @retval CRYPT_SUCCESS The tag is correct
+ * @retval CRYPT_MODES_TAG_VERIFY_FAIL The tag is incorrect
+ */
+int32_t MODES_AeadCheckTag(const uint8_t *tag, const uint8_t *expectTag, uint32_t tagLen, uint8_t *out,
+    uint32_t outLen);
+
 static inline void MODE_IncCounter(uint8_t *counter, uint32_t counterLen)
 {
     uint32_t i = counterLen;
@@ -104,6 +104,7 @@ const CRYPT_EAL_Func g_defCcm[] = {
     {CRYPT_EAL_IMPLCIPHER_DEINITCTX, (CRYPT_EAL_ImplCipherDeinitCtx)MODES_CCM_DeInitCtx},
     {CRYPT_EAL_IMPLCIPHER_CTRL, (CRYPT_EAL_ImplCipherCtrl)MODES_CCM_Ctrl},
     {CRYPT_EAL_IMPLCIPHER_FREECTX, (CRYPT_EAL_ImplCipherFreeCtx)MODES_CCM_FreeCtx},
+    {CRYPT_EAL_IMPLCIPHER_AEAD, (CRYPT_EAL_ImplCipherAead)MODES_CCM_Aead},
 #endif
     CRYPT_EAL_FUNC_END,
 };
@@ -130,6 +131,7 @@ const CRYPT_EAL_Func g_defChaCha[] = {
     {CRYPT_EAL_IMPLCIPHER_DEINITCTX, (CRYPT_EAL_ImplCipherDeinitCtx)MODES_CHACHA20POLY1305_DeInitCtx},
     {CRYPT_EAL_IMPLCIPHER_CTRL, (CRYPT_EAL_ImplCipherCtrl)MODES_CHACHA20POLY1305_Ctrl},
     {CRYPT_EAL_IMPLCIPHER_FREECTX, (CRYPT_EAL_ImplCipherFreeCtx)MODES_CHACHA20POLY1305_FreeCtx},
+    {CRYPT_EAL_IMPLCIPHER_AEAD, (CRYPT_EAL_ImplCipherAead)MODES_CHACHA20POLY1305_Aead},
 #endif
     CRYPT_EAL_FUNC_END,
 };
@@ -169,6 +171,7 @@ const CRYPT_EAL_Func g_defGcm[] = {
     {CRYPT_EAL_IMPLCIPHER_DEINITCTX, (CRYPT_EAL_ImplCipherDeinitCtx)MODES_GCM_DeInitCtx},
     {CRYPT_EAL_IMPLCIPHER_CTRL, (CRYPT_EAL_ImplCipherCtrl)MODES_GCM_Ctrl},
     {CRYPT_EAL_IMPLCIPHER_FREECTX, (CRYPT_EAL_ImplCipherFreeCtx)MODES_GCM_FreeCtx},
+    {CRYPT_EAL_IMPLCIPHER_AEAD, (CRYPT_EAL_ImplCipherAead)MODES_GCM_Aead},
 #endif
     CRYPT_EAL_FUNC_END,
 };
@@ -90,6 +90,33 @@ typedef struct {
     const uint8_t *authKey;
 } BSL_UIO_SctpAuthKey;
 
+/**
+ * @ingroup bsl_uio
+ * @brief   Record protection algorithms that can be offloaded to the kernel TLS (kTLS)
+ */
+typedef enum {
+    BSL_UIO_KTLS_AES_128_GCM,
+    BSL_UIO_KTLS_AES_256_GCM,
+    BSL_UIO_KTLS_CHACHA20_POLY1305,
+    BSL_UIO_KTLS_SM4_GCM,
+} BSL_UIO_KtlsCipher;
+
+/**
+ * @ingroup bsl_uio
+ * @brief   Traffic key of one direction, hitls Use the BSL_UIO_Method.ctrl method to transfer the
+ *          BSL_UIO_TCP_SET_KTLS instruction to offload the record protection of the direction to the kernel.
+ */
+typedef struct {
+    bool isSend;                /* true: records to be sent, false: records to be received */
+    uint16_t version;           /* TLS version, 0x0303 (TLS 1.2) or 0x0304 (TLS 1.3) */
+    BSL_UIO_KtlsCipher cipher;
+    const uint8_t *key;
+    uint32_t keyLen;
+    const uint8_t *iv;          /* Implicit IV, the salt of the GCM nonce in TLS 1.2 */
+    uint32_t ivLen;
+    uint64_t seq;               /* Sequence number of the next record */
+} BSL_UIO_KtlsCryptoInfo;
+
 /**
  * @ingroup bsl_uio
  * @brief   BSL_UIO_CtrlParameter controls the I/O callback function. Hitls notifies the
@@ -135,6 +162,10 @@ typedef enum {
     BSL_UIO_MEM_SET_EOF,
     BSL_UIO_MEM_GET_EOF,
     BSL_UIO_MEM_GET_INFO,
+    /* TCP uses 0x5XX */
+    BSL_UIO_TCP_SET_KTLS = 0x500,
+    BSL_UIO_TCP_SET_KTLS_RECORD_TYPE,
+    BSL_UIO_TCP_GET_KTLS_RECORD_TYPE,
 } BSL_UIO_CtrlParameter;
 
 typedef enum {
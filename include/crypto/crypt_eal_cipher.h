@@ -33,6 +33,18 @@ extern "C" {
 
 typedef struct CryptEalCipherCtx CRYPT_EAL_CipherCtx;
 
+/**
+ * @ingroup crypt_eal_cipher
+ * @brief   One message of CRYPT_EAL_CipherAeadSealBatch.
+ */
+typedef struct {
+    CRYPT_ConstData nonce;  /**< Nonce of the message */
+    CRYPT_ConstData aad;    /**< Additional authenticated data, the length can be 0 */
+    CRYPT_ConstData in;     /**< Plaintext */
+    uint8_t *out;           /**< Ciphertext, the length is in.len */
+    CRYPT_Data tag;         /**< Buffer of the tag, tag.len is the length of the tag to be generated */
+} CRYPT_EAL_AeadRecord;
+
 /**
  * @ingroup crypt_eal_cipher, Not supported in provider
  * @brief   Check whether the given symmetric algorithm ID is valid.
@@ -135,6 +147,9 @@ int32_t CRYPT_EAL_CipherReinit(CRYPT_EAL_CipherCtx *ctx, uint8_t *iv, uint32_t i
  *
  * @attention If the function is called by an external user and the error stack is concerned, it is recommended
  * that BSL_ERR_ClearError() be called before this function is called.
+ * The output may be the same buffer as the input (out == in) in the GCM, CCM and ChaCha20-Poly1305 modes, the
+ * data is encrypted or decrypted in place. An output that begins inside the input is rejected with
+ * CRYPT_EAL_ERR_PART_OVERLAP.
  *
  * @param ctx [IN] Symmetric encryption and decryption handle
  * @param in [IN] Continuously input data
@@ -217,6 +232,63 @@ int32_t CRYPT_EAL_CipherFinal(CRYPT_EAL_CipherCtx *ctx, uint8_t *out, uint32_t *
  */
 int32_t CRYPT_EAL_CipherCtrl(CRYPT_EAL_CipherCtx *ctx, int32_t type, void *data, uint32_t len);
 
+/**
+ * @ingroup crypt_eal_cipher
+ * @brief Encrypt a whole message with an AEAD algorithm and output the tag in one call. It is equivalent to
+ *        CRYPT_EAL_CipherReinit with the nonce, CRYPT_CTRL_SET_TAGLEN, CRYPT_CTRL_SET_MSGLEN (CCM only),
+ *        CRYPT_CTRL_SET_AAD, CRYPT_EAL_CipherUpdate and CRYPT_CTRL_GET_TAG.
+ *
+ * @attention The ctx must have been initialized for encryption by CRYPT_EAL_CipherInit, the key is kept between
+ *            calls. The function can be called again with a new nonce without CRYPT_EAL_CipherReinit.
+ *            The output may be the same buffer as the input.
+ * @param ctx [IN] Symmetric encryption handle of GCM, CCM or ChaCha20-Poly1305
+ * @param nonce [IN] Nonce of the message, the length is the one of the IV in CRYPT_EAL_CipherInit
+ * @param aad [IN] Additional authenticated data, which can be NULL if there is none
+ * @param in [IN] Plaintext
+ * @param out [OUT] Ciphertext, the length is in->len
+ * @param tag [IN/OUT] Buffer of the tag, tag->len is the length of the tag to be generated
+ * @retval #CRYPT_SUCCESS, success.
+ *         Other error codes see the crypt_errno.h
+ */
+int32_t CRYPT_EAL_CipherAeadSeal(CRYPT_EAL_CipherCtx *ctx, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, CRYPT_Data *tag);
+
+/**
+ * @ingroup crypt_eal_cipher
+ * @brief Decrypt a whole message with an AEAD algorithm and verify its tag in one call.
+ *
+ * @attention The ctx must have been initialized for decryption by CRYPT_EAL_CipherInit, the key is kept between
+ *            calls. The tag is compared in constant time, and the output is cleared if the tag is incorrect.
+ *            The output may be the same buffer as the input.
+ * @param ctx [IN] Symmetric decryption handle of GCM, CCM or ChaCha20-Poly1305
+ * @param nonce [IN] Nonce of the message, the length is the one of the IV in CRYPT_EAL_CipherInit
+ * @param aad [IN] Additional authenticated data, which can be NULL if there is none
+ * @param in [IN] Ciphertext without the tag
+ * @param out [OUT] Plaintext, the length is in->len
+ * @param tag [IN] Tag of the message
+ * @retval #CRYPT_SUCCESS, success.
+ * @retval #CRYPT_MODES_TAG_VERIFY_FAIL, the tag is incorrect.
+ *         Other error codes see the crypt_errno.h
+ */
+int32_t CRYPT_EAL_CipherAeadOpen(CRYPT_EAL_CipherCtx *ctx, const CRYPT_ConstData *nonce, const CRYPT_ConstData *aad,
+    const CRYPT_ConstData *in, uint8_t *out, const CRYPT_ConstData *tag);
+
+/**
+ * @ingroup crypt_eal_cipher
+ * @brief Encrypt several independent messages with the same key in one call, each with its own nonce and AAD.
+ *        The result is the same as calling CRYPT_EAL_CipherAeadSeal for each message in order, but the
+ *        parameters are checked once before any message is encrypted and the algorithm is dispatched once.
+ *
+ * @attention The ctx must have been initialized for encryption by CRYPT_EAL_CipherInit. The output of each message
+ *            may be the same buffer as its input. If an error is returned, none of the outputs can be used.
+ * @param ctx [IN] Symmetric encryption handle of GCM, CCM or ChaCha20-Poly1305
+ * @param records [IN/OUT] Messages to be encrypted
+ * @param num [IN] Number of the messages
+ * @retval #CRYPT_SUCCESS, success.
+ *         Other error codes see the crypt_errno.h
+ */
+int32_t CRYPT_EAL_CipherAeadSealBatch(CRYPT_EAL_CipherCtx *ctx, CRYPT_EAL_AeadRecord *records, uint32_t num);
+
 /**
  * @ingroup crypt_eal_cipher
  * @brief Set the padding mode.
@@ -113,6 +113,7 @@ typedef int32_t (*CRYPT_EAL_ImplProviderInit)(CRYPT_EAL_ProvMgrCtx *mgrCtx, BSL_
 #define CRYPT_EAL_IMPLCIPHER_DEINITCTX   5
 #define CRYPT_EAL_IMPLCIPHER_CTRL        6
 #define CRYPT_EAL_IMPLCIPHER_FREECTX     7
+#define CRYPT_EAL_IMPLCIPHER_AEAD        8
 
 typedef void *(*CRYPT_EAL_ImplCipherNewCtx)(void *provCtx, int32_t algId);
 typedef int32_t (*CRYPT_EAL_ImplCipherInitCtx)(void *ctx, const uint8_t *key, uint32_t keyLen,
@@ -123,6 +124,9 @@ typedef int32_t (*CRYPT_EAL_ImplCipherFinal)(void *ctx, uint8_t *out, uint32_t *
 typedef int32_t (*CRYPT_EAL_ImplCipherDeinitCtx)(void *ctx);
 typedef int32_t (*CRYPT_EAL_ImplCipherCtrl)(void *ctx, int32_t cmd, void *val, uint32_t valLen);
 typedef void (*CRYPT_EAL_ImplCipherFreeCtx)(void *ctx);
+/* Optional. One-shot AEAD, enc is true to seal and write the tag, false to open and verify the tag. */
+typedef int32_t (*CRYPT_EAL_ImplCipherAead)(void *ctx, bool enc, const CRYPT_ConstData *nonce,
+    const CRYPT_ConstData *aad, const CRYPT_ConstData *in, uint8_t *out, uint8_t *tag, uint32_t tagLen);
 
 
 // CRYPT_EAL_OPERAID_KEYMGMT
@@ -310,6 +310,7 @@ enum CRYPT_ERROR {
     CRYPT_MODES_METHODS_NOT_SUPPORT,                 /**< Mode depends does not support the behavior. */
     CRYPT_MODES_FEEDBACKSIZE_NOT_SUPPORT,            /**< The algorithm does not support the setting of feedbacksize. */
     CRYPT_MODES_PADDING_NOT_SUPPORT,                 /**< Unsupported padding. */
+    CRYPT_MODES_TAG_VERIFY_FAIL,                     /**< In AEAD mode, the tag of the ciphertext is incorrect. */
 
     CRYPT_HKDF_DKLEN_OVERFLOW = 0x01110001,          /**< The length of the derived key exceeds the maximum. */
     CRYPT_HKDF_NOT_SUPPORTED,                        /**< Unsupport HKDF algorithm. */
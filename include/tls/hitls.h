@@ -199,6 +199,56 @@ int32_t HITLS_Read(HITLS_Ctx *ctx, uint8_t *data, uint32_t bufSize, uint32_t *re
  */
 int32_t HITLS_Peek(HITLS_Ctx *ctx, uint8_t *data, uint32_t bufSize, uint32_t *readLen);
 
+/**
+ * @ingroup hitls
+ * @brief   Borrow the decrypted application data of the current record without copying it.
+ *
+ * If no decrypted data is buffered, the next application record is read as HITLS_Peek does. On TLS connections
+ * using an AEAD cipher suite, the record is decrypted in place in the read buffer of the connection.
+ *
+ * @attention The data is read-only and remains valid until HITLS_ConsumeReadBuffer consumes all of it or any other
+ *            read, write or handshake interface is called on the connection. Only the data of one record is returned.
+ * @param   ctx [IN] TLS context
+ * @param   buf [OUT] Start of the unread data of the current record
+ * @param   len [OUT] Length of the unread data of the current record
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  For other error codes, see HITLS_Read.
+ */
+int32_t HITLS_PeekReadBuffer(HITLS_Ctx *ctx, const uint8_t **buf, uint32_t *len);
+
+/**
+ * @ingroup hitls
+ * @brief   Release len bytes of the data borrowed by HITLS_PeekReadBuffer.
+ *
+ * @attention The record buffer is released after all of its data is consumed.
+ * @param   ctx [IN] TLS context
+ * @param   len [IN] Number of bytes that have been processed
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_INVALID_INPUT, len exceeds the length returned by HITLS_PeekReadBuffer.
+ */
+int32_t HITLS_ConsumeReadBuffer(HITLS_Ctx *ctx, uint32_t len);
+
+/**
+ * @ingroup hitls
+ * @brief   Read application data into multiple segments.
+ *
+ * The segments are filled in sequence. The record is decrypted directly into the first non-empty segment if the
+ * segment can hold it, and the rest of the record is scattered into the following segments.
+ *
+ * @attention Reads the data of at most one record, which is the same as HITLS_Read.
+ * @param   ctx [IN] TLS context
+ * @param   iov [IN] Segments to be filled
+ * @param   iovCnt [IN] Number of the segments
+ * @param   readLen [OUT] Total number of bytes read into the segments
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_APP_ERR_ZERO_READ_BUF_LEN, the total length of the segments is 0.
+ * @retval  For other error codes, see HITLS_Read.
+ */
+int32_t HITLS_Readv(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *readLen);
+
 /**
  * @ingroup hitls
  * @brief   Write data.
@@ -207,6 +257,10 @@ int32_t HITLS_Peek(HITLS_Ctx *ctx, uint8_t *data, uint32_t bufSize, uint32_t *re
  *
  * @attention The length of the data to be sent cannot exceed the maximum writable length,
  *            which can be obtained by calling HITLS_GetMaxWriteSize.
+ *            If HITLS_MODE_MULTI_RECORD_WRITE is set on a TLS (not DTLS) connection, data of any length is split
+ *            into multiple records, which are packed into the write buffer and sent in batches. When
+ *            HITLS_REC_NORMAL_IO_BUSY is returned, writeLen indicates the length that has already been sent,
+ *            and the function must be called again with the same data and dataLen.
  * @param   ctx [IN] TLS context
  * @param   data [IN] Data to be written
  * @param   dataLen [IN] Length to be written
@@ -219,6 +273,25 @@ int32_t HITLS_Peek(HITLS_Ctx *ctx, uint8_t *data, uint32_t bufSize, uint32_t *re
  */
 int32_t HITLS_Write(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen);
 
+/**
+ * @ingroup hitls
+ * @brief   Write data gathered from multiple segments.
+ *
+ * Identical to HITLS_Write except that the data is the concatenation of the segments in sequence. The segments are
+ * gathered into the record plaintext directly, so the caller does not need to copy them into one buffer.
+ *
+ * @attention When HITLS_REC_NORMAL_IO_BUSY is returned, the function must be called again with the same segments.
+ * @param   ctx [IN] TLS context
+ * @param   iov [IN] Segments of the data to be written
+ * @param   iovCnt [IN] Number of the segments
+ * @param   writeLen [OUT] Length of Successful Writes
+ * @retval  HITLS_SUCCESS is sent successfully.
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null or the total length of the segments is 0.
+ * @retval  HITLS_REC_NORMAL_IO_BUSY, The network I/O is busy and needs to wait for the next sending.
+ * @retval  For other error codes, see HITLS_Write.
+ */
+int32_t HITLS_Writev(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen);
+
 /**
  * @ingroup hitls
  * @brief   Obtain the maximum writable (plaintext) length.
@@ -387,6 +460,30 @@ int32_t HITLS_IsAead(const HITLS_Ctx *ctx, uint8_t *isAead);
  */
 int32_t HITLS_IsDtls(const HITLS_Ctx *ctx, uint8_t *isDtls);
 
+/**
+ * @ingroup hitls
+ * @brief   Check whether the records to be sent are protected by the kernel TLS, see HITLS_MODE_KTLS.
+ *
+ * @param   ctx [IN] TLS object
+ * @param   isKtls [OUT] 1: the kernel protects the records to be sent; 0: they are protected in user space.
+ * @retval  HITLS_SUCCESS, is obtained successfully.
+ *          HITLS_NULL_INPUT, The input parameter pointer is null.
+ */
+int32_t HITLS_IsKtlsSend(const HITLS_Ctx *ctx, uint8_t *isKtls);
+
+/**
+ * @ingroup hitls
+ * @brief   Check whether the records received are verified by the kernel TLS, see HITLS_MODE_KTLS.
+ *
+ * @attention If records had been read ahead when the handshake completed, they are processed in user space first,
+ *            and the offload takes effect once they are consumed.
+ * @param   ctx [IN] TLS object
+ * @param   isKtls [OUT] 1: the kernel verifies the records received; 0: they are verified in user space.
+ * @retval  HITLS_SUCCESS, is obtained successfully.
+ *          HITLS_NULL_INPUT, The input parameter pointer is null.
+ */
+int32_t HITLS_IsKtlsRecv(const HITLS_Ctx *ctx, uint8_t *isKtls);
+
 /**
  * @ingroup hitls
  * @brief   Record the error value of the HiTLS link.
@@ -1424,6 +1521,40 @@ int32_t HITLS_SetMaxSendFragment(HITLS_Ctx *ctx, uint16_t maxSendFragment);
  */
 int32_t HITLS_GetMaxSendFragment(const HITLS_Ctx *ctx, uint16_t *maxSendFragment);
 
+/**
+ * @ingroup hitls
+ * @brief   Set the record_size_limit (RFC 8449) advertised to the peer, see HITLS_CFG_SetRecordSizeLimit.
+ *
+ * @param   ctx [IN/OUT] TLS connection handle.
+ * @param   recordSizeLimit [IN] Limit of the records received, 0 indicates that the extension is not sent
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is NULL.
+ * @retval  HITLS_CONFIG_INVALID_LENGTH, the recordSizeLimit is not 0 and is less than 64 or greater than 16385.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_SetRecordSizeLimit(HITLS_Ctx *ctx, uint16_t recordSizeLimit);
+
+/**
+ * @ingroup hitls
+ * @brief   Obtain the record_size_limit advertised to the peer.
+ *
+ * @param   ctx [IN] TLS connection handle.
+ * @param   recordSizeLimit [OUT] Limit of the records received
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is NULL.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_GetRecordSizeLimit(const HITLS_Ctx *ctx, uint16_t *recordSizeLimit);
+
+/**
+ * @ingroup hitls
+ * @brief   Obtain the record_size_limit that the peer advertises and that is in effect for the records sent.
+ *
+ * @param   ctx [IN] TLS connection handle.
+ * @param   recordSizeLimit [OUT] Limit of the records sent, 0 indicates that the peer sets no limit
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is NULL.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_GetPeerRecordSizeLimit(const HITLS_Ctx *ctx, uint16_t *recordSizeLimit);
+
 /**
  * @ingroup hitls
  * @brief   Sets the maximum size of the certificate chain that can be sent from the peer end.
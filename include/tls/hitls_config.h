@@ -1383,6 +1383,31 @@ int32_t HITLS_CFG_SetMaxSendFragment(HITLS_Config *config, uint16_t maxSendFragm
  */
 int32_t HITLS_CFG_GetMaxSendFragment(const HITLS_Config *config, uint16_t *maxSendFragment);
 
+/**
+ * @ingroup hitls_config
+ * @brief   Set the record_size_limit (RFC 8449) advertised to the peer. If both ends send the extension, the
+ *          plaintext of each protected record sent by the peer does not exceed the limit. The limit includes the
+ *          content type in TLS1.3, and a TLS1.2 server advertises at most 16384.
+ *
+ * @param   config [IN/OUT] TLS link configuration
+ * @param   recordSizeLimit [IN] Limit of the records received, 0 (default) indicates that the extension is not sent
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_CONFIG_INVALID_LENGTH, the recordSizeLimit is not 0 and is less than 64 or greater than 16385.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_CFG_SetRecordSizeLimit(HITLS_Config *config, uint16_t recordSizeLimit);
+
+/**
+ * @ingroup hitls_config
+ * @brief   Obtain the record_size_limit advertised to the peer.
+ *
+ * @param   config [IN] TLS link configuration.
+ * @param   recordSizeLimit [OUT] Limit of the records received
+ * @retval  HITLS_NULL_INPUT, the input parameter pointer is null.
+ * @retval  HITLS_SUCCESS, if successful.
+ */
+int32_t HITLS_CFG_GetRecordSizeLimit(const HITLS_Config *config, uint16_t *recordSizeLimit);
+
 /**
  * @ingroup hitls_config
  * @brief   Set the maximum size of the certificate chain that can be sent by the peer end.
@@ -246,6 +246,21 @@ typedef struct {
     HITLS_Cipher_Ctx **ctx;             /**< HITLS_Cipher_Ctx handle */
 } HITLS_CipherParameters;
 
+/**
+ * @ingroup hitls_crypt_type
+ * @brief One record of a batch AEAD encryption, which is encrypted with the key in HITLS_CipherParameters.
+ */
+typedef struct {
+    const uint8_t *iv;                  /**< Nonce of the record. */
+    uint32_t ivLen;                     /**< Nonce length. */
+    const uint8_t *aad;                 /**< Additional data of the record. */
+    uint32_t aadLen;                    /**< Aad length. */
+    const uint8_t *in;                  /**< Plaintext of the record. */
+    uint32_t inLen;                     /**< Plaintext length. */
+    uint8_t *out;                       /**< Ciphertext followed by the tag, which may be the same as in. */
+    uint32_t outLen;                    /**< IN: Length of the out buffer. OUT: Length of the ciphertext and tag. */
+} HITLS_AeadRecord;
+
 /**
  * @ingroup hitls_crypt_type
  * @brief   sm2  ecdhe negotiation key parameters
@@ -119,6 +119,15 @@ typedef enum {
     HITLS_KEY_UPDATE_REQ_END = 255
 } HITLS_KeyUpdateRequest;
 
+/**
+ * @ingroup hitls_type
+ * @brief   Data segment used by HITLS_Writev and HITLS_Readv
+ */
+typedef struct {
+    void *base;             /**< Start address of the segment */
+    uint32_t len;           /**< Length of the segment */
+} HITLS_Iovec;
+
 #define HITLS_MODE_ENABLE_PARTIAL_WRITE       0x00000001U
 #define HITLS_MODE_ACCEPT_MOVING_WRITE_BUFFER 0x00000002U
 #define HITLS_MODE_AUTO_RETRY                 0x00000004U
@@ -129,6 +138,14 @@ typedef enum {
 #define HITLS_MODE_SEND_FALLBACK_SCSV         0x00000080U
 #define HITLS_MODE_ASYNC                      0x00000100U
 #define HITLS_MODE_DTLS_SCTP_LABEL_LENGTH_BUG 0x00000400U
+/* HITLS_Write splits data longer than one record into multiple records and sends them in batches (TLS only) */
+#define HITLS_MODE_MULTI_RECORD_WRITE         0x00000800U
+/* After the handshake, the record protection of TLS 1.2/TLS 1.3 AEAD connections over TCP is offloaded to the Linux
+ * kernel TLS (kTLS). Each direction the kernel does not support is still processed in user space. */
+#define HITLS_MODE_KTLS                       0x00001000U
+/* Application records sent after the connection is idle for a second fit in one TCP segment, and grow by one segment
+ * per record until they reach the maximum length (TLS only) */
+#define HITLS_MODE_DYNAMIC_RECORD_SIZE        0x00002000U
 
 /* close_notify message has been sent to the peer end, turn off the alarm, and the connection is considered closed. */
 # define HITLS_SENT_SHUTDOWN       1u
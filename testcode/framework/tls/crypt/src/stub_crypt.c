@@ -787,10 +787,11 @@ int32_t STUB_CRYPT_EncryptCallback(const HITLS_CipherParameters *cipher, const u
         if (*outLen < inLen + AEAD_TAG_LENGTH) {
             return HITLS_INTERNAL_EXCEPTION;
         }
-        (void)memset_s(out, *outLen, 0, *outLen);
-        if (inLen != 0 && memcpy_s(out, *outLen, in, inLen) != EOK) {
+        /* in and out may point to the same address */
+        if (inLen != 0 && memmove_s(out, *outLen, in, inLen) != EOK) {
             return HITLS_MEMCPY_FAIL;
         }
+        (void)memset_s(out + inLen, *outLen - inLen, 0, *outLen - inLen);
         *outLen = inLen + AEAD_TAG_LENGTH;
     } else {
         *outLen = 0;
@@ -828,8 +829,8 @@ int32_t STUB_CRYPT_DecryptCallback(const HITLS_CipherParameters *cipher, const u
         if (inLen < AEAD_TAG_LENGTH) {
             return HITLS_INTERNAL_EXCEPTION;
         }
-        (void)memset_s(out, *outLen, 0, *outLen);
-        if (memcpy_s(out, *outLen, in, inLen - AEAD_TAG_LENGTH) != EOK) {
+        /* in and out may point to the same address */
+        if (memmove_s(out, *outLen, in, inLen - AEAD_TAG_LENGTH) != EOK) {
             return HITLS_MEMCPY_FAIL;
         }
         *outLen = inLen - AEAD_TAG_LENGTH;
@@ -108,6 +108,11 @@ int32_t FRAME_Ctrl(BSL_UIO *uio, int32_t cmd, int32_t larg, void *param)
         *(int32_t *)param = FAKE_BSL_UIO_FD;
     }
 
+    /* The simulated transport has no kernel TLS, the records are always protected by the TLS connection */
+    if (cmd == BSL_UIO_TCP_SET_KTLS) {
+        return BSL_UIO_FAIL;
+    }
+
     return BSL_SUCCESS;
 }
 
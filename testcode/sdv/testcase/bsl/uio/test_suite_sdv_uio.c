@@ -991,6 +991,66 @@ EXIT:
 }
 /* END_CASE */
 
+/**
+ * @test  SDV_BSL_UIO_TCP_KTLS_TC001
+ * @title  Kernel tls ctrl test of the tcp uio
+ * @precon  nan
+ * @brief
+ *    1. Call BSL_UIO_New to create a tcp uio without fd, and set the kernel tls key. Expected result 1 is obtained.
+ *    2. Set the fd of a unix socket, and set the kernel tls key with an invalid length. Expected result 2 is obtained.
+ *    3. Set the kernel tls key. Expected result 3 is obtained.
+ *    4. Get the record type of the last read, set the record type of the data to be written. Expected result 4 is
+ *       obtained.
+ *    5. Write data and read it from the peer socket. Expected result 5 is obtained.
+ * @expect
+ *    1. Return BSL_UIO_FAIL.
+ *    2. Return BSL_INVALID_ARG.
+ *    3. Return BSL_UIO_FAIL, because the kernel tls is not available on a unix socket.
+ *    4. Return BSL_SUCCESS, and the record type is application data.
+ *    5. The data is transferred in plaintext.
+ */
+/* BEGIN_CASE */
+void SDV_BSL_UIO_TCP_KTLS_TC001(void)
+{
+#ifdef HITLS_BSL_UIO_TCP
+    int fds[2] = {-1, -1};
+    uint8_t key[16] = {0};
+    uint8_t iv[4] = {0};
+    BSL_UIO_KtlsCryptoInfo info = {true, 0x0303, BSL_UIO_KTLS_AES_128_GCM, key, sizeof(key), iv, sizeof(iv), 0};
+    BSL_UIO *uio = BSL_UIO_New(BSL_UIO_TcpMethod());
+    ASSERT_TRUE(uio != NULL);
+    ASSERT_EQ(BSL_UIO_Ctrl(uio, BSL_UIO_TCP_SET_KTLS, (int32_t)sizeof(info), &info), BSL_UIO_FAIL);
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    BSL_UIO_SetFD(uio, fds[0]);
+    ASSERT_EQ(BSL_UIO_Ctrl(uio, BSL_UIO_TCP_SET_KTLS, (int32_t)sizeof(info) - 1, &info), BSL_INVALID_ARG);
+    ASSERT_EQ(BSL_UIO_Ctrl(uio, BSL_UIO_TCP_SET_KTLS, (int32_t)sizeof(info), &info), BSL_UIO_FAIL);
+
+    uint8_t type = 0;
+    ASSERT_EQ(BSL_UIO_Ctrl(uio, BSL_UIO_TCP_GET_KTLS_RECORD_TYPE, (int32_t)sizeof(type), &type), BSL_SUCCESS);
+    ASSERT_EQ(type, 23);
+    type = 22;
+    ASSERT_EQ(BSL_UIO_Ctrl(uio, BSL_UIO_TCP_SET_KTLS_RECORD_TYPE, (int32_t)sizeof(type), &type), BSL_SUCCESS);
+
+    const uint8_t data[] = "ktls";
+    uint8_t buf[sizeof(data)] = {0};
+    uint32_t len = 0;
+    ASSERT_EQ(BSL_UIO_Write(uio, data, sizeof(data), &len), BSL_SUCCESS);
+    ASSERT_EQ(len, sizeof(data));
+    ASSERT_EQ(read(fds[1], buf, sizeof(buf)), (ssize_t)sizeof(data));
+    ASSERT_EQ(memcmp(buf, data, sizeof(data)), 0);
+EXIT:
+    BSL_UIO_Free(uio);
+    if (fds[0] != -1) {
+        close(fds[0]);
+        close(fds[1]);
+    }
+#else
+    SKIP_TEST();
+#endif
+}
+/* END_CASE */
+
 /**
  * @test  SDV_BSL_UIO_NEXT_TC001
  * @title  Uio next test
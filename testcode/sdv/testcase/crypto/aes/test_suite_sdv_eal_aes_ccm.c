@@ -856,4 +856,66 @@ void SDV_CRYPTO_AES_CCM_MULTI_THREAD_FUNC_TC001(int isProvider, int algId, Hex *
 EXIT:
     return;
 }
-/* END_CASE */
\ No newline at end of file
+/* END_CASE */
+
+/**
+ * @test  SDV_CRYPTO_AES_CCM_AEAD_ONESHOT_TC001
+ * @title  AES-CCM one-shot seal and open test
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Call the one-shot seal interface twice with the same nonce, in place. Expected result 1 is obtained.
+ *    2.Call the one-shot open interface in place. Expected result 2 is obtained.
+ *    3.Modify the tag and call the one-shot open interface. Expected result 3 is obtained.
+ * @expect
+ *    1.Both calls succeed, the ciphertext and the tag are consistent with the test vector.
+ *    2.Success, the buffer holds the plaintext.
+ *    3.Return CRYPT_MODES_TAG_VERIFY_FAIL and the output is cleared.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_CCM_AEAD_ONESHOT_TC001(int isProvider, int algId, Hex *key, Hex *iv, Hex *aad, Hex *pt, Hex *ct, Hex *tag)
+{
+#ifndef HITLS_CRYPTO_CCM
+    SKIP_TEST();
+#endif
+    TestMemInit();
+    CRYPT_EAL_CipherCtx *encCtx = NULL;
+    CRYPT_EAL_CipherCtx *decCtx = NULL;
+    uint8_t outTag[16] = {0};
+    uint8_t *buf = (uint8_t *)BSL_SAL_Calloc(pt->len + 1, sizeof(uint8_t));
+    ASSERT_TRUE(buf != NULL);
+    ASSERT_TRUE(tag->len <= sizeof(outTag));
+    CRYPT_ConstData nonce = {iv->x, iv->len};
+    CRYPT_ConstData aadData = {aad->x, aad->len};
+    CRYPT_ConstData in = {buf, pt->len};
+    CRYPT_Data sealTag = {outTag, tag->len};
+    CRYPT_ConstData openTag = {outTag, tag->len};
+
+    encCtx = TestCipherNewCtx(NULL, algId, "provider=default", isProvider);
+    ASSERT_TRUE(encCtx != NULL);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(encCtx, key->x, key->len, iv->x, iv->len, true), CRYPT_SUCCESS);
+    for (int i = 0; i < 2; i++) {
+        (void)memcpy_s(buf, pt->len + 1, pt->x, pt->len);
+        ASSERT_EQ(CRYPT_EAL_CipherAeadSeal(encCtx, &nonce, &aadData, &in, buf, &sealTag), CRYPT_SUCCESS);
+        ASSERT_COMPARE("Compare Ciphertext", buf, pt->len, ct->x, ct->len);
+        ASSERT_COMPARE("Compare Tag", outTag, tag->len, tag->x, tag->len);
+    }
+
+    decCtx = TestCipherNewCtx(NULL, algId, "provider=default", isProvider);
+    ASSERT_TRUE(decCtx != NULL);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(decCtx, key->x, key->len, iv->x, iv->len, false), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherAeadOpen(decCtx, &nonce, &aadData, &in, buf, &openTag), CRYPT_SUCCESS);
+    ASSERT_COMPARE("Compare Plaintext", buf, pt->len, pt->x, pt->len);
+
+    (void)memcpy_s(buf, pt->len + 1, ct->x, ct->len);
+    outTag[0] ^= 0x01;
+    ASSERT_EQ(CRYPT_EAL_CipherAeadOpen(decCtx, &nonce, &aadData, &in, buf, &openTag), CRYPT_MODES_TAG_VERIFY_FAIL);
+    for (uint32_t i = 0; i < pt->len; i++) {
+        ASSERT_EQ(buf[i], 0);
+    }
+
+EXIT:
+    CRYPT_EAL_CipherFreeCtx(encCtx);
+    CRYPT_EAL_CipherFreeCtx(decCtx);
+    BSL_SAL_Free(buf);
+}
+/* END_CASE */
@@ -167,3 +167,183 @@ EXIT:
     FREE(outTag);
 }
 /* END_CASE */
+
+/**
+ * @test  SDV_CRYPTO_AES_GCM_UPDATE_INPLACE_TC001
+ * @title  AES-GCM in-place decryption test
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Call the update interface with an output that begins inside the input. Expected result 1 is obtained.
+ *    2.Call the update interface with the same buffer as the input and the output. Expected result 2 is obtained.
+ *    3.Call the Ctrl interface to get tag. Expected result 3 is obtained.
+ * @expect
+ *    1.Return CRYPT_EAL_ERR_PART_OVERLAP.
+ *    2.The update is successful and the buffer holds the plaintext.
+ *    3.Tag is consistent with the test vector.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_GCM_UPDATE_INPLACE_TC001(int isProvider, int algId, Hex *key, Hex *iv,
+    Hex *aad, Hex *pt, Hex *ct, Hex *tag)
+{
+#ifndef HITLS_CRYPTO_GCM
+    SKIP_TEST();
+#endif
+    TestMemInit();
+    CRYPT_EAL_CipherCtx *ctx = NULL;
+    uint8_t outTag[16] = {0};
+    uint32_t tagLen = tag->len;
+    uint32_t bufLen = ct->len + 1;
+    uint8_t *buf = (uint8_t *)BSL_SAL_Calloc(bufLen, sizeof(uint8_t));
+    ASSERT_TRUE(buf != NULL);
+    ASSERT_TRUE(memcpy_s(buf, bufLen, ct->x, ct->len) == EOK);
+
+    ctx = TestCipherNewCtx(NULL, algId, "provider=default", isProvider);
+    ASSERT_TRUE(ctx != NULL);
+    ASSERT_TRUE(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, false) == CRYPT_SUCCESS);
+    ASSERT_TRUE(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_TAGLEN, &tagLen, sizeof(tagLen)) == CRYPT_SUCCESS);
+    ASSERT_TRUE(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_AAD, aad->x, aad->len) == CRYPT_SUCCESS);
+    uint32_t outLen = bufLen - 1;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, buf, ct->len, buf + 1, &outLen), CRYPT_EAL_ERR_PART_OVERLAP);
+    outLen = ct->len;
+    ASSERT_EQ(CRYPT_EAL_CipherUpdate(ctx, buf, ct->len, buf, &outLen), CRYPT_SUCCESS);
+    ASSERT_COMPARE("Compare Plaintext", buf, outLen, pt->x, pt->len);
+    ASSERT_TRUE(tagLen <= sizeof(outTag));
+    ASSERT_EQ(CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_GET_TAG, outTag, tagLen), CRYPT_SUCCESS);
+    ASSERT_COMPARE("Compare Tag", outTag, tagLen, tag->x, tag->len);
+
+EXIT:
+    CRYPT_EAL_CipherFreeCtx(ctx);
+    BSL_SAL_Free(buf);
+}
+/* END_CASE */
+
+/**
+ * @test  SDV_CRYPTO_AES_GCM_AEAD_ONESHOT_TC001
+ * @title  AES-GCM one-shot seal and open test
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Call the one-shot seal interface twice with the same nonce, in place. Expected result 1 is obtained.
+ *    2.Call the one-shot open interface in place. Expected result 2 is obtained.
+ *    3.Modify the tag and call the one-shot open interface. Expected result 3 is obtained.
+ * @expect
+ *    1.Both calls succeed, the ciphertext and the tag are consistent with the test vector.
+ *    2.Success, the buffer holds the plaintext.
+ *    3.Return CRYPT_MODES_TAG_VERIFY_FAIL and the output is cleared.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_GCM_AEAD_ONESHOT_TC001(int isProvider, int algId, Hex *key, Hex *iv, Hex *aad, Hex *pt, Hex *ct, Hex *tag)
+{
+#ifndef HITLS_CRYPTO_GCM
+    SKIP_TEST();
+#endif
+    TestMemInit();
+    CRYPT_EAL_CipherCtx *encCtx = NULL;
+    CRYPT_EAL_CipherCtx *decCtx = NULL;
+    uint8_t outTag[16] = {0};
+    uint8_t *buf = (uint8_t *)BSL_SAL_Calloc(pt->len + 1, sizeof(uint8_t));
+    ASSERT_TRUE(buf != NULL);
+    ASSERT_TRUE(tag->len <= sizeof(outTag));
+    CRYPT_ConstData nonce = {iv->x, iv->len};
+    CRYPT_ConstData aadData = {aad->x, aad->len};
+    CRYPT_ConstData in = {buf, pt->len};
+    CRYPT_Data sealTag = {outTag, tag->len};
+    CRYPT_ConstData openTag = {outTag, tag->len};
+
+    encCtx = TestCipherNewCtx(NULL, algId, "provider=default", isProvider);
+    ASSERT_TRUE(encCtx != NULL);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(encCtx, key->x, key->len, iv->x, iv->len, true), CRYPT_SUCCESS);
+    for (int i = 0; i < 2; i++) {
+        (void)memcpy_s(buf, pt->len + 1, pt->x, pt->len);
+        ASSERT_EQ(CRYPT_EAL_CipherAeadSeal(encCtx, &nonce, &aadData, &in, buf, &sealTag), CRYPT_SUCCESS);
+        ASSERT_COMPARE("Compare Ciphertext", buf, pt->len, ct->x, ct->len);
+        ASSERT_COMPARE("Compare Tag", outTag, tag->len, tag->x, tag->len);
+    }
+
+    decCtx = TestCipherNewCtx(NULL, algId, "provider=default", isProvider);
+    ASSERT_TRUE(decCtx != NULL);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(decCtx, key->x, key->len, iv->x, iv->len, false), CRYPT_SUCCESS);
+    ASSERT_EQ(CRYPT_EAL_CipherAeadOpen(decCtx, &nonce, &aadData, &in, buf, &openTag), CRYPT_SUCCESS);
+    ASSERT_COMPARE("Compare Plaintext", buf, pt->len, pt->x, pt->len);
+
+    (void)memcpy_s(buf, pt->len + 1, ct->x, ct->len);
+    outTag[0] ^= 0x01;
+    ASSERT_EQ(CRYPT_EAL_CipherAeadOpen(decCtx, &nonce, &aadData, &in, buf, &openTag), CRYPT_MODES_TAG_VERIFY_FAIL);
+    for (uint32_t i = 0; i < pt->len; i++) {
+        ASSERT_EQ(buf[i], 0);
+    }
+
+EXIT:
+    CRYPT_EAL_CipherFreeCtx(encCtx);
+    CRYPT_EAL_CipherFreeCtx(decCtx);
+    BSL_SAL_Free(buf);
+}
+/* END_CASE */
+
+#define AEAD_BATCH_TEST_NUM 3
+
+/**
+ * @test  SDV_CRYPTO_AES_GCM_AEAD_BATCH_TC001
+ * @title  AES-GCM batch seal test
+ * @precon Registering memory-related functions.
+ * @brief
+ *    1.Call the batch seal interface with a record whose tag buffer is NULL. Expected result 1 is obtained.
+ *    2.Call the batch seal interface with several records in place, the records have different AAD.
+ *      Expected result 2 is obtained.
+ *    3.Seal the records one by one with the one-shot seal interface. Expected result 3 is obtained.
+ * @expect
+ *    1.Return CRYPT_NULL_INPUT and no record is encrypted.
+ *    2.Success, the ciphertext and the tag of the first record are consistent with the test vector.
+ *    3.The ciphertext and the tag of each record are the same as those of the batch seal.
+ */
+/* BEGIN_CASE */
+void SDV_CRYPTO_AES_GCM_AEAD_BATCH_TC001(int isProvider, int algId, Hex *key, Hex *iv, Hex *aad, Hex *pt, Hex *ct,
+    Hex *tag)
+{
+#ifndef HITLS_CRYPTO_GCM
+    SKIP_TEST();
+#endif
+    TestMemInit();
+    CRYPT_EAL_CipherCtx *ctx = NULL;
+    uint8_t *buf = (uint8_t *)BSL_SAL_Calloc(pt->len * AEAD_BATCH_TEST_NUM + 1, sizeof(uint8_t));
+    uint8_t *expect = (uint8_t *)BSL_SAL_Calloc(pt->len + 1, sizeof(uint8_t));
+    uint8_t outTag[AEAD_BATCH_TEST_NUM][16] = {0};
+    uint8_t expectTag[16] = {0};
+    CRYPT_EAL_AeadRecord records[AEAD_BATCH_TEST_NUM];
+    ASSERT_TRUE(buf != NULL && expect != NULL);
+    ASSERT_TRUE(tag->len <= sizeof(expectTag));
+    for (uint32_t i = 0; i < AEAD_BATCH_TEST_NUM; i++) {
+        uint8_t *out = buf + pt->len * i;
+        (void)memcpy_s(out, pt->len + 1, pt->x, pt->len);
+        records[i].nonce = (CRYPT_ConstData){iv->x, iv->len};
+        records[i].aad = (CRYPT_ConstData){aad->x, (i % 2 == 0) ? aad->len : 0};
+        records[i].in = (CRYPT_ConstData){out, pt->len};
+        records[i].out = out;
+        records[i].tag = (CRYPT_Data){outTag[i], tag->len};
+    }
+
+    ctx = TestCipherNewCtx(NULL, algId, "provider=default", isProvider);
+    ASSERT_TRUE(ctx != NULL);
+    ASSERT_EQ(CRYPT_EAL_CipherInit(ctx, key->x, key->len, iv->x, iv->len, true), CRYPT_SUCCESS);
+    records[AEAD_BATCH_TEST_NUM - 1].tag.data = NULL;
+    ASSERT_EQ(CRYPT_EAL_CipherAeadSealBatch(ctx, records, AEAD_BATCH_TEST_NUM), CRYPT_NULL_INPUT);
+    ASSERT_COMPARE("Compare Unchanged", buf, pt->len, pt->x, pt->len);
+    records[AEAD_BATCH_TEST_NUM - 1].tag.data = outTag[AEAD_BATCH_TEST_NUM - 1];
+
+    ASSERT_EQ(CRYPT_EAL_CipherAeadSealBatch(ctx, records, AEAD_BATCH_TEST_NUM), CRYPT_SUCCESS);
+    ASSERT_COMPARE("Compare Ciphertext", buf, pt->len, ct->x, ct->len);
+    ASSERT_COMPARE("Compare Tag", outTag[0], tag->len, tag->x, tag->len);
+    for (uint32_t i = 0; i < AEAD_BATCH_TEST_NUM; i++) {
+        CRYPT_ConstData in = {pt->x, pt->len};
+        CRYPT_Data sealTag = {expectTag, tag->len};
+        ASSERT_EQ(CRYPT_EAL_CipherAeadSeal(ctx, &records[i].nonce, &records[i].aad, &in, expect, &sealTag),
+            CRYPT_SUCCESS);
+        ASSERT_COMPARE("Compare Batch Ciphertext", records[i].out, pt->len, expect, pt->len);
+        ASSERT_COMPARE("Compare Batch Tag", outTag[i], tag->len, expectTag, tag->len);
+    }
+
+EXIT:
+    CRYPT_EAL_CipherFreeCtx(ctx);
+    BSL_SAL_Free(buf);
+    BSL_SAL_Free(expect);
+}
+/* END_CASE */
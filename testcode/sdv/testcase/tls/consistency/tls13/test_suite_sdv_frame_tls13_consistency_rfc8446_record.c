@@ -2556,4 +2556,68 @@ EXIT:
     FRAME_FreeLink(client);
     FRAME_FreeLink(server);
 }
-/* END_CASE */
\ No newline at end of file
+/* END_CASE */
+static uint64_t RecordPaddingCb(HITLS_Ctx *ctx, int32_t type, uint64_t length, void *arg)
+{
+    (void)ctx;
+    (void)type;
+    (void)length;
+    return *(uint32_t *)arg;
+}
+
+/** @
+* @test     UT_TLS_TLS13_RFC8446_CONSISTENCY_INNER_PLAINTEXT_FUNC_TC001
+* @spec     struct {
+*               opaque content[TLSPlaintext.length];
+*               ContentType type;
+*               uint8 zeros[length_of_padding];
+*           } TLSInnerPlaintext;
+* @title    The TLSInnerPlaintext is built and encrypted in the record buffer.
+* @precon   nan
+* @brief    5.2. Record Payload Protection
+*           1. Set the record padding length and establish a TLS1.3 connection. Expected result 1.
+*           2. The client sends app data of the specified length, the server reads it. Expected result 2.
+*           3. The client sends app data of the maximum length, the server reads it. Expected result 2.
+* @expect   1. The connection is established.
+*           2. The ciphertext length contains the content type and padding, and the server reads the same data.
+@ */
+/* BEGIN_CASE */
+void UT_TLS_TLS13_RFC8446_CONSISTENCY_INNER_PLAINTEXT_FUNC_TC001(int dataLen, int paddingLen)
+{
+    FRAME_Init();
+    HITLS_Config *tlsConfig = HITLS_CFG_NewTLS13Config();
+    ASSERT_TRUE(tlsConfig != NULL);
+    uint32_t padding = (uint32_t)paddingLen;
+    ASSERT_EQ(HITLS_CFG_SetRecordPaddingCb(tlsConfig, RecordPaddingCb), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_CFG_SetRecordPaddingCbArg(tlsConfig, &padding), HITLS_SUCCESS);
+    FRAME_LinkObj *client = FRAME_CreateLink(tlsConfig, BSL_UIO_TCP);
+    FRAME_LinkObj *server = FRAME_CreateLink(tlsConfig, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_EQ(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT), HITLS_SUCCESS);
+
+    uint8_t src[REC_MAX_PLAIN_LENGTH];
+    for (uint32_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)i;
+    }
+    uint8_t dest[READ_BUF_SIZE] = {0};
+    uint32_t lens[] = {(uint32_t)dataLen, REC_MAX_PLAIN_LENGTH - padding};
+    for (uint32_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+        uint32_t writeLen = 0;
+        ASSERT_EQ(HITLS_Write(client->ssl, src, lens[i], &writeLen), HITLS_SUCCESS);
+        ASSERT_EQ(writeLen, lens[i]);
+        FrameUioUserData *ioClientData = BSL_UIO_GetUserData(client->io);
+        /* record header + content + content type + padding + tag */
+        ASSERT_EQ(ioClientData->sndMsg.len, REC_TLS_RECORD_HEADER_LEN + lens[i] + 1 + padding + 16);
+        ASSERT_EQ(FRAME_TrasferMsgBetweenLink(client, server), HITLS_SUCCESS);
+        uint32_t readLen = 0;
+        ASSERT_EQ(HITLS_Read(server->ssl, dest, READ_BUF_SIZE, &readLen), HITLS_SUCCESS);
+        ASSERT_EQ(readLen, lens[i]);
+        ASSERT_EQ(memcmp(src, dest, lens[i]), 0);
+    }
+EXIT:
+    HITLS_CFG_FreeConfig(tlsConfig);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
@@ -789,6 +789,439 @@ EXIT:
 }
 /* END_CASE */
 
+/* @
+* @test UT_TLS_HITLS_MULTI_RECORD_WRITE_TC001
+* @brief    1. Establish connection between server and client, the client sets HITLS_MODE_MULTI_RECORD_WRITE and
+               maxSendFragment 512
+            2. client calls HITLS_Write to send 32768 bytes, which are more than one record
+            3. server reads the data, client calls HITLS_Write again with the same buffer until all data is sent
+            4. server reads the rest of the data
+* @expect   1. Return HITLS_SUCCESS
+            2. Return HITLS_REC_NORMAL_IO_BUSY, the writeLen is the length of the data in the first batch
+            3. Return HITLS_SUCCESS finally, the writeLen is 32768
+            4. The data read by the server is the same as the data sent by the client
+@ */
+/* BEGIN_CASE */
+void UT_TLS_HITLS_MULTI_RECORD_WRITE_TC001(int tlsVersion)
+{
+    FRAME_Init();
+    const uint32_t dataLen = 32768;
+    uint8_t *sndBuf = NULL;
+    uint8_t *rcvBuf = NULL;
+    HITLS_Config *config = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config != NULL);
+
+    FRAME_LinkObj *client = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    FRAME_LinkObj *server = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_TRUE(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT) == HITLS_SUCCESS);
+    /* The batch of records must fit into the send buffer of the test frame */
+    ASSERT_EQ(HITLS_SetMaxSendFragment(client->ssl, 512), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_SetModeSupport(client->ssl, HITLS_MODE_MULTI_RECORD_WRITE), HITLS_SUCCESS);
+
+    sndBuf = BSL_SAL_Malloc(dataLen);
+    rcvBuf = BSL_SAL_Calloc(dataLen, sizeof(uint8_t));
+    ASSERT_TRUE(sndBuf != NULL && rcvBuf != NULL);
+    for (uint32_t i = 0; i < dataLen; i++) {
+        sndBuf[i] = (uint8_t)i;
+    }
+
+    uint32_t writeLen = 0;
+    uint32_t totalReadLen = 0;
+    ASSERT_EQ(HITLS_Write(client->ssl, sndBuf, dataLen, &writeLen), HITLS_REC_NORMAL_IO_BUSY);
+    ASSERT_TRUE(writeLen > 512 && writeLen < dataLen);
+    int32_t ret;
+    do {
+        ASSERT_EQ(FRAME_TrasferMsgBetweenLink(client, server), HITLS_SUCCESS);
+        uint32_t readLen = 0;
+        while (HITLS_Read(server->ssl, &rcvBuf[totalReadLen], dataLen - totalReadLen, &readLen) == HITLS_SUCCESS) {
+            totalReadLen += readLen;
+        }
+        ret = HITLS_Write(client->ssl, sndBuf, dataLen, &writeLen);
+        ASSERT_TRUE(ret == HITLS_SUCCESS || ret == HITLS_REC_NORMAL_IO_BUSY);
+    } while (ret != HITLS_SUCCESS);
+    ASSERT_EQ(writeLen, dataLen);
+
+    ASSERT_EQ(FRAME_TrasferMsgBetweenLink(client, server), HITLS_SUCCESS);
+    uint32_t readLen = 0;
+    while (HITLS_Read(server->ssl, &rcvBuf[totalReadLen], dataLen - totalReadLen, &readLen) == HITLS_SUCCESS) {
+        totalReadLen += readLen;
+    }
+    ASSERT_EQ(totalReadLen, dataLen);
+    ASSERT_EQ(memcmp(sndBuf, rcvBuf, dataLen), 0);
+EXIT:
+    BSL_SAL_FREE(sndBuf);
+    BSL_SAL_FREE(rcvBuf);
+    HITLS_CFG_FreeConfig(config);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
+
+/* @
+* @test UT_TLS_HITLS_WRITEV_READV_TC001
+* @brief    1. Establish connection between server and client
+            2. client calls HITLS_Writev to send a header segment, an empty segment and two body segments
+            3. server calls HITLS_Readv with three segments, the first segment is smaller than the record
+            4. client calls HITLS_Write, server calls HITLS_Readv with a first segment which can hold the record
+* @expect   1. Return HITLS_SUCCESS
+            2. Return HITLS_SUCCESS, the writeLen is the total length of the segments
+            3. Return HITLS_SUCCESS, the segments are filled in sequence with the data sent by the client
+            4. Return HITLS_SUCCESS, the record is read into the first segment
+@ */
+/* BEGIN_CASE */
+void UT_TLS_HITLS_WRITEV_READV_TC001(int tlsVersion)
+{
+    FRAME_Init();
+
+    HITLS_Config *config = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config != NULL);
+
+    FRAME_LinkObj *client = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    FRAME_LinkObj *server = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_TRUE(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT) == HITLS_SUCCESS);
+
+    uint8_t header[9] = "HTTP/1.1 ";
+    uint8_t body1[1000];
+    uint8_t body2[2000];
+    uint8_t expect[sizeof(header) + sizeof(body1) + sizeof(body2)];
+    (void)memset_s(body1, sizeof(body1), 'a', sizeof(body1));
+    (void)memset_s(body2, sizeof(body2), 'b', sizeof(body2));
+    (void)memcpy_s(expect, sizeof(expect), header, sizeof(header));
+    (void)memcpy_s(expect + sizeof(header), sizeof(expect) - sizeof(header), body1, sizeof(body1));
+    (void)memcpy_s(expect + sizeof(header) + sizeof(body1), sizeof(body2), body2, sizeof(body2));
+    HITLS_Iovec wIov[] = {{header, sizeof(header)}, {NULL, 0}, {body1, sizeof(body1)}, {body2, sizeof(body2)}};
+    uint32_t writeLen = 0;
+    ASSERT_EQ(HITLS_Writev(client->ssl, NULL, 1, &writeLen), HITLS_NULL_INPUT);
+    ASSERT_EQ(HITLS_Writev(client->ssl, &wIov[1], 1, &writeLen), HITLS_NULL_INPUT);
+    ASSERT_EQ(HITLS_Writev(client->ssl, wIov, sizeof(wIov) / sizeof(wIov[0]), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(writeLen, sizeof(expect));
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+
+    uint8_t seg1[16] = {0};
+    uint8_t seg2[1000] = {0};
+    uint8_t seg3[4096] = {0};
+    HITLS_Iovec rIov[] = {{seg1, sizeof(seg1)}, {seg2, sizeof(seg2)}, {seg3, sizeof(seg3)}};
+    uint32_t readLen = 0;
+    ASSERT_EQ(HITLS_Readv(server->ssl, rIov, sizeof(rIov) / sizeof(rIov[0]), &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, sizeof(expect));
+    ASSERT_EQ(memcmp(seg1, expect, sizeof(seg1)), 0);
+    ASSERT_EQ(memcmp(seg2, expect + sizeof(seg1), sizeof(seg2)), 0);
+    ASSERT_EQ(memcmp(seg3, expect + sizeof(seg1) + sizeof(seg2), sizeof(expect) - sizeof(seg1) - sizeof(seg2)), 0);
+    ASSERT_EQ(HITLS_GetReadPendingBytes(server->ssl), 0);
+
+    ASSERT_EQ(HITLS_Write(client->ssl, body1, sizeof(body1), &writeLen), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+    HITLS_Iovec rIov2[] = {{NULL, 0}, {seg3, sizeof(seg3)}, {seg1, sizeof(seg1)}};
+    ASSERT_EQ(HITLS_Readv(server->ssl, rIov2, sizeof(rIov2) / sizeof(rIov2[0]), &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, sizeof(body1));
+    ASSERT_EQ(memcmp(seg3, body1, sizeof(body1)), 0);
+EXIT:
+    HITLS_CFG_FreeConfig(config);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
+
+/* @
+* @test UT_TLS_HITLS_PEEK_READ_BUFFER_TC001
+* @brief    1. Establish connection between server and client
+            2. client sends a record, server calls HITLS_PeekReadBuffer
+            3. server calls HITLS_ConsumeReadBuffer with part of the data, then calls HITLS_PeekReadBuffer again
+            4. server calls HITLS_ConsumeReadBuffer with a length larger than the rest of the data
+            5. server calls HITLS_Read to read the rest of the data
+            6. client sends another record, server borrows and consumes all of it
+* @expect   1. Return HITLS_SUCCESS
+            2. Return HITLS_SUCCESS, the borrowed buffer holds the data sent by the client
+            3. Return HITLS_SUCCESS, the rest of the data is returned at the consumed offset of the same buffer
+            4. Return HITLS_INVALID_INPUT
+            5. Return HITLS_SUCCESS, the rest of the data is read
+            6. Return HITLS_SUCCESS, no data is pending after the record is consumed
+@ */
+/* BEGIN_CASE */
+void UT_TLS_HITLS_PEEK_READ_BUFFER_TC001(int tlsVersion)
+{
+    FRAME_Init();
+
+    HITLS_Config *config = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config != NULL);
+
+    FRAME_LinkObj *client = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    FRAME_LinkObj *server = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_TRUE(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT) == HITLS_SUCCESS);
+
+    uint8_t data[3000];
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)i;
+    }
+    uint32_t writeLen = 0;
+    ASSERT_EQ(HITLS_Write(client->ssl, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+
+    const uint8_t *buf = NULL;
+    uint32_t len = 0;
+    ASSERT_EQ(HITLS_PeekReadBuffer(server->ssl, NULL, &len), HITLS_NULL_INPUT);
+    ASSERT_EQ(HITLS_PeekReadBuffer(server->ssl, &buf, &len), HITLS_SUCCESS);
+    ASSERT_EQ(len, sizeof(data));
+    ASSERT_EQ(memcmp(buf, data, sizeof(data)), 0);
+    ASSERT_EQ(HITLS_GetReadPendingBytes(server->ssl), sizeof(data));
+
+    const uint8_t *firstBuf = buf;
+    ASSERT_EQ(HITLS_ConsumeReadBuffer(server->ssl, 1000), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_PeekReadBuffer(server->ssl, &buf, &len), HITLS_SUCCESS);
+    ASSERT_TRUE(buf == firstBuf + 1000);
+    ASSERT_EQ(len, sizeof(data) - 1000);
+    ASSERT_EQ(HITLS_ConsumeReadBuffer(server->ssl, len + 1), HITLS_INVALID_INPUT);
+
+    uint8_t readBuf[4096] = {0};
+    uint32_t readLen = 0;
+    ASSERT_EQ(HITLS_Read(server->ssl, readBuf, sizeof(readBuf), &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, sizeof(data) - 1000);
+    ASSERT_EQ(memcmp(readBuf, data + 1000, readLen), 0);
+
+    ASSERT_EQ(HITLS_Write(client->ssl, data, 100, &writeLen), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_PeekReadBuffer(server->ssl, &buf, &len), HITLS_SUCCESS);
+    ASSERT_EQ(len, 100);
+    ASSERT_EQ(memcmp(buf, data, len), 0);
+    ASSERT_EQ(HITLS_ConsumeReadBuffer(server->ssl, len), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_GetReadPendingBytes(server->ssl), 0);
+    ASSERT_EQ(HITLS_ConsumeReadBuffer(server->ssl, 1), HITLS_INVALID_INPUT);
+EXIT:
+    HITLS_CFG_FreeConfig(config);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
+
+/* @
+* @test UT_TLS_HITLS_READ_INPLACE_TC001
+* @brief    1. Establish connection between server and client with an AEAD cipher suite
+            2. client sends two records, server reads them with a buffer smaller than a record
+* @expect   1. Return HITLS_SUCCESS
+            2. Return HITLS_SUCCESS, the records decrypted in the read buffer are read in order
+@ */
+/* BEGIN_CASE */
+void UT_TLS_HITLS_READ_INPLACE_TC001(int tlsVersion)
+{
+    FRAME_Init();
+
+    HITLS_Config *config = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config != NULL);
+    uint16_t cipherSuite = (tlsVersion == HITLS_VERSION_TLS13) ?
+        HITLS_CHACHA20_POLY1305_SHA256 : HITLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256;
+    ASSERT_EQ(HITLS_CFG_SetCipherSuites(config, &cipherSuite, 1), HITLS_SUCCESS);
+
+    BSL_UIO_TransportType type = (tlsVersion == HITLS_VERSION_DTLS12) ? BSL_UIO_UDP : BSL_UIO_TCP;
+    FRAME_LinkObj *client = FRAME_CreateLink(config, type);
+    ASSERT_TRUE(client != NULL);
+    FRAME_LinkObj *server = FRAME_CreateLink(config, type);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_TRUE(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT) == HITLS_SUCCESS);
+
+    uint8_t data[2000];
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)i;
+    }
+    uint32_t writeLen = 0;
+    ASSERT_EQ(HITLS_Write(client->ssl, data, sizeof(data) / 2, &writeLen), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+
+    uint8_t readBuf[sizeof(data)] = {0};
+    uint32_t total = 0;
+    uint32_t readLen = 0;
+    ASSERT_EQ(HITLS_Read(server->ssl, readBuf, 100, &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, 100);
+    total += readLen;
+
+    ASSERT_EQ(HITLS_Write(client->ssl, data + sizeof(data) / 2, sizeof(data) / 2, &writeLen), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+    while (total < sizeof(data)) {
+        ASSERT_EQ(HITLS_Read(server->ssl, readBuf + total, 100, &readLen), HITLS_SUCCESS);
+        ASSERT_TRUE(readLen > 0);
+        total += readLen;
+    }
+    ASSERT_EQ(memcmp(readBuf, data, sizeof(data)), 0);
+    ASSERT_EQ(HITLS_GetReadPendingBytes(server->ssl), 0);
+EXIT:
+    HITLS_CFG_FreeConfig(config);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
+
+/* @
+* @test UT_TLS_HITLS_KTLS_FALLBACK_TC001
+* @brief    1. Configure HITLS_MODE_KTLS and establish connection between server and client over a UIO without kernel
+*              tls support
+*           2. Check whether the records are protected by the kernel
+*           3. Transfer app data in both directions, then close the connection
+* @expect   1. Return HITLS_SUCCESS
+*           2. Both directions are processed in user space
+*           3. The data is received and the close_notify is processed
+@ */
+/* BEGIN_CASE */
+void UT_TLS_HITLS_KTLS_FALLBACK_TC001(int tlsVersion)
+{
+    FRAME_Init();
+
+    HITLS_Config *config = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config != NULL);
+    ASSERT_EQ(HITLS_CFG_SetModeSupport(config, HITLS_MODE_KTLS), HITLS_SUCCESS);
+
+    FRAME_LinkObj *client = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    FRAME_LinkObj *server = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_TRUE(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT) == HITLS_SUCCESS);
+
+    uint8_t isKtls = 1;
+    ASSERT_EQ(HITLS_IsKtlsSend(NULL, &isKtls), HITLS_NULL_INPUT);
+    ASSERT_EQ(HITLS_IsKtlsRecv(client->ssl, NULL), HITLS_NULL_INPUT);
+    ASSERT_EQ(HITLS_IsKtlsSend(client->ssl, &isKtls), HITLS_SUCCESS);
+    ASSERT_EQ(isKtls, 0);
+    ASSERT_EQ(HITLS_IsKtlsRecv(server->ssl, &isKtls), HITLS_SUCCESS);
+    ASSERT_EQ(isKtls, 0);
+
+    uint8_t data[] = "Hello World";
+    uint32_t writeLen = 0;
+    uint8_t readBuf[READ_BUF_SIZE] = {0};
+    uint32_t readLen = 0;
+    ASSERT_EQ(HITLS_Write(client->ssl, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(server->ssl, readBuf, sizeof(readBuf), &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, sizeof(data));
+    ASSERT_EQ(memcmp(readBuf, data, readLen), 0);
+
+    ASSERT_EQ(HITLS_Write(server->ssl, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(server, client) == HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(client->ssl, readBuf, sizeof(readBuf), &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, sizeof(data));
+    ASSERT_EQ(memcmp(readBuf, data, readLen), 0);
+
+    ASSERT_EQ(HITLS_Close(client->ssl), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(server->ssl, readBuf, sizeof(readBuf), &readLen), HITLS_CM_LINK_CLOSED);
+EXIT:
+    HITLS_CFG_FreeConfig(config);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
+
+/* @
+* @test UT_TLS_HITLS_RECORD_SIZE_LIMIT_TC001
+* @brief    1. Set an invalid record_size_limit
+            2. The client advertises 512 and the server advertises 1024, establish connection between them
+            3. Obtain the limits of both ends
+            4. client sends 3000 bytes, server reads them
+            5. server sends 3000 bytes, client reads them
+* @expect   1. Return HITLS_CONFIG_INVALID_LENGTH
+            2. Return HITLS_SUCCESS
+            3. Each end uses the limit advertised by the peer for the records sent
+            4. The client writes at most 1024 bytes (1023 in TLS1.3) per record, the server reads them
+            5. The server writes at most 512 bytes (511 in TLS1.3) per record, the client reads them
+@ */
+/* BEGIN_CASE */
+void UT_TLS_HITLS_RECORD_SIZE_LIMIT_TC001(int tlsVersion)
+{
+    FRAME_Init();
+
+    HITLS_Config *config = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config != NULL);
+    ASSERT_EQ(HITLS_CFG_SetRecordSizeLimit(config, 63), HITLS_CONFIG_INVALID_LENGTH);
+    ASSERT_EQ(HITLS_CFG_SetRecordSizeLimit(config, 16386), HITLS_CONFIG_INVALID_LENGTH);
+
+    FRAME_LinkObj *client = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    FRAME_LinkObj *server = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_EQ(HITLS_SetRecordSizeLimit(client->ssl, 512), HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_SetRecordSizeLimit(server->ssl, 1024), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT) == HITLS_SUCCESS);
+
+    uint16_t limit = 0;
+    ASSERT_EQ(HITLS_GetRecordSizeLimit(client->ssl, &limit), HITLS_SUCCESS);
+    ASSERT_EQ(limit, 512);
+    ASSERT_EQ(HITLS_GetPeerRecordSizeLimit(client->ssl, &limit), HITLS_SUCCESS);
+    ASSERT_EQ(limit, 1024);
+    ASSERT_EQ(HITLS_GetPeerRecordSizeLimit(server->ssl, &limit), HITLS_SUCCESS);
+    ASSERT_EQ(limit, 512);
+
+    uint32_t contentTypeLen = (tlsVersion == HITLS_VERSION_TLS13) ? 1 : 0;
+    uint8_t data[3000] = {0};
+    uint8_t readBuf[3000] = {0};
+    uint32_t writeLen = 0;
+    uint32_t readLen = 0;
+    ASSERT_EQ(HITLS_Write(client->ssl, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(writeLen, 1024 - contentTypeLen);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(server->ssl, readBuf, sizeof(readBuf), &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, writeLen);
+
+    ASSERT_EQ(HITLS_Write(server->ssl, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(writeLen, 512 - contentTypeLen);
+    ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(server, client) == HITLS_SUCCESS);
+    ASSERT_EQ(HITLS_Read(client->ssl, readBuf, sizeof(readBuf), &readLen), HITLS_SUCCESS);
+    ASSERT_EQ(readLen, writeLen);
+EXIT:
+    HITLS_CFG_FreeConfig(config);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
+
+/* @
+* @test UT_TLS_HITLS_DYNAMIC_RECORD_SIZE_TC001
+* @brief    1. Set HITLS_MODE_DYNAMIC_RECORD_SIZE on the client, establish connection between server and client
+            2. client sends 16384 bytes three times
+            3. client sends data after the connection is idle for more than one second
+* @expect   1. Return HITLS_SUCCESS
+            2. The records grow by 1369 bytes each
+            3. The record size is reset to 1369 bytes
+@ */
+/* BEGIN_CASE */
+void UT_TLS_HITLS_DYNAMIC_RECORD_SIZE_TC001(int tlsVersion)
+{
+    FRAME_Init();
+
+    HITLS_Config *config = GetHitlsConfigViaVersion(tlsVersion);
+    ASSERT_TRUE(config != NULL);
+
+    FRAME_LinkObj *client = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(client != NULL);
+    FRAME_LinkObj *server = FRAME_CreateLink(config, BSL_UIO_TCP);
+    ASSERT_TRUE(server != NULL);
+    ASSERT_EQ(HITLS_SetModeSupport(client->ssl, HITLS_MODE_DYNAMIC_RECORD_SIZE), HITLS_SUCCESS);
+    ASSERT_TRUE(FRAME_CreateConnection(client, server, true, HS_STATE_BUTT) == HITLS_SUCCESS);
+
+    uint8_t data[16384] = {0};
+    uint8_t readBuf[16384] = {0};
+    uint32_t writeLen = 0;
+    uint32_t readLen = 0;
+    for (uint32_t i = 1; i <= 3; i++) {
+        ASSERT_EQ(HITLS_Write(client->ssl, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+        ASSERT_EQ(writeLen, 1369 * i);
+        ASSERT_TRUE(FRAME_TrasferMsgBetweenLink(client, server) == HITLS_SUCCESS);
+        ASSERT_EQ(HITLS_Read(server->ssl, readBuf, sizeof(readBuf), &readLen), HITLS_SUCCESS);
+        ASSERT_EQ(readLen, writeLen);
+    }
+
+    sleep(2);
+    ASSERT_EQ(HITLS_Write(client->ssl, data, sizeof(data), &writeLen), HITLS_SUCCESS);
+    ASSERT_EQ(writeLen, 1369);
+EXIT:
+    HITLS_CFG_FreeConfig(config);
+    FRAME_FreeLink(client);
+    FRAME_FreeLink(server);
+}
+/* END_CASE */
+
 /* @
 * @test  UT_TLS_SetTmpDhCb_TC001
 * @spec  -
@@ -62,6 +62,8 @@ int32_t APP_GetMaxWriteSize(const TLS_Ctx *ctx, uint32_t *len);
  * @ingroup app
  * @brief Send app message in the unit of record.
  *
+ * @attention If HITLS_MODE_MULTI_RECORD_WRITE is set for a TLS connection, the whole data is sent in multiple records.
+ *
  * @param ctx [IN] TLS context
  * @param data [IN] Data to be written
  * @param dataLen [IN] Data length
@@ -73,6 +75,37 @@ int32_t APP_GetMaxWriteSize(const TLS_Ctx *ctx, uint32_t *len);
  */
 int32_t APP_Write(TLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen);
 
+/**
+ * @ingroup app
+ * @brief Send app message gathered from multiple segments in the unit of record.
+ *
+ * @param ctx [IN] TLS context
+ * @param iov [IN] Segments of the data to be written
+ * @param iovCnt [IN] Number of the segments
+ * @param writeLen [OUT] Length of Successful Writes
+ *
+ * @retval HITLS_SUCCESS Write successful.
+ * @retval HITLS_APP_ERR_TOO_LONG_TO_WRITE The total length of the segments overflows.
+ * @retval Other reuturn value referst to APP_Write.
+ */
+int32_t APP_Writev(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen);
+
+/**
+ * @ingroup app
+ * @brief Scatter the remaining app data of the current record into multiple segments.
+ *
+ * @attention No record is read from the I/O, the read stops when the current record is consumed.
+ *
+ * @param ctx [IN] TLS context
+ * @param iov [IN] Segments to be filled in sequence
+ * @param iovCnt [IN] Number of the segments
+ * @param readLen [OUT] Read length
+ *
+ * @retval HITLS_SUCCESS Read successful.
+ * @retval Other return value refers to REC_Read.
+ */
+int32_t APP_Readv(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *readLen);
+
 #ifdef __cplusplus
 }
 #endif
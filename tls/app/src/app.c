@@ -86,20 +86,30 @@ static int32_t SavePendingData(TLS_Ctx *ctx, const uint8_t *data, uint32_t dataL
 static int32_t CheckDataLen(TLS_Ctx *ctx, const uint8_t *data, uint32_t *sendLen)
 {
     uint32_t maxWriteLen = 0u;
-    int32_t ret = REC_GetMaxWriteSize(ctx, &maxWriteLen);
+    int32_t ret = REC_GetMaxAppWriteSize(ctx, &maxWriteLen);
     if (ret != HITLS_SUCCESS) {
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15660, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "APP: Get record max write size fail.", 0, 0, 0, 0);
         return ret;
     }
-    if (*sendLen > maxWriteLen) {
+    RecCtx *recCtx = (RecCtx *)ctx->recCtx;
+    if (recCtx->pendingData != NULL) {
+        /* The record of the last call has been built, the length of the data sent again must not change */
+        maxWriteLen = recCtx->pendingDataSize;
+    }
+    if (*sendLen > maxWriteLen
+#ifdef HITLS_TLS_PROTO_TLS
+        && !REC_IsMultiRecordWrite(ctx)
+#endif
+        ) {
         *sendLen = maxWriteLen;
     }
 
     return SavePendingData(ctx, data, *sendLen);
 }
 
-int32_t APP_Write(TLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t AppWriteData(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t dataLen,
+    uint32_t *writeLen)
 {
     int32_t ret = HITLS_SUCCESS;
 #if defined(HITLS_TLS_PROTO_DTLS12) && defined(HITLS_BSL_UIO_UDP)
@@ -113,6 +123,12 @@ int32_t APP_Write(TLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t
         return ret;
     }
 
+    /* The first non-empty segment identifies the data to be sent again after I/O busy */
+    uint32_t first = 0;
+    while (first + 1 < iovCnt && iov[first].len == 0) {
+        first++;
+    }
+    const uint8_t *data = (const uint8_t *)iov[first].base;
     uint32_t sendLen = dataLen;
     ret = CheckDataLen(ctx, data, &sendLen);
     if (ret != HITLS_SUCCESS) {
@@ -120,7 +136,17 @@ int32_t APP_Write(TLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t
     }
     *writeLen = 0;
 
-    ret = REC_Write(ctx, REC_TYPE_APP, data, sendLen);
+#ifdef HITLS_TLS_PROTO_TLS
+    if (REC_IsMultiRecordWrite(ctx) && sendLen != 0) {
+        /* Data of any length is split into records, which are sent in batches */
+        ret = REC_WriteMultiRecord(ctx, iov, iovCnt, sendLen, writeLen);
+    } else
+#endif
+    if (iovCnt > 1) {
+        ret = REC_Writev(ctx, iov, iovCnt, sendLen);
+    } else {
+        ret = REC_Write(ctx, REC_TYPE_APP, data, sendLen);
+    }
     if (ret != HITLS_SUCCESS) {
         return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16274, "Write fail");
     }
@@ -141,4 +167,44 @@ int32_t APP_Write(TLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t
     ctx->recCtx->pendingData = NULL;
     ctx->recCtx->pendingDataSize = 0;
     return HITLS_SUCCESS;
+}
+
+int32_t APP_Write(TLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+{
+    HITLS_Iovec iov = { (void *)(uintptr_t)data, dataLen };
+    return AppWriteData(ctx, &iov, 1, dataLen, writeLen);
+}
+
+int32_t APP_Writev(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
+{
+    uint32_t dataLen = 0;
+    for (uint32_t i = 0; i < iovCnt; i++) {
+        if (iov[i].len > UINT32_MAX - dataLen) {
+            BSL_ERR_PUSH_ERROR(HITLS_APP_ERR_TOO_LONG_TO_WRITE);
+            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17368, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                "APP: total length of the segments is too long.", 0, 0, 0, 0);
+            return HITLS_APP_ERR_TOO_LONG_TO_WRITE;
+        }
+        dataLen += iov[i].len;
+    }
+    return AppWriteData(ctx, iov, iovCnt, dataLen, writeLen);
+}
+
+int32_t APP_Readv(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *readLen)
+{
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < iovCnt && APP_GetReadPendingBytes(ctx) > 0; i++) {
+        uint32_t offset = 0;
+        while (offset < iov[i].len && APP_GetReadPendingBytes(ctx) > 0) {
+            uint32_t len = 0;
+            int32_t ret = APP_Read(ctx, (uint8_t *)iov[i].base + offset, iov[i].len - offset, &len);
+            if (ret != HITLS_SUCCESS) {
+                return ret;
+            }
+            offset += len;
+            total += len;
+        }
+    }
+    *readLen = total;
+    return HITLS_SUCCESS;
 }
\ No newline at end of file
@@ -260,6 +260,9 @@ int32_t CommonEventInHandshakingState(HITLS_Ctx *ctx)
 
     // If HS_DoHandshake returns success, the connection has been established.
     ChangeConnState(ctx, CM_STATE_TRANSPORTING);
+#ifdef HITLS_TLS_FEATURE_KTLS
+    REC_KtlsEnable(ctx);
+#endif
 
     /* In the UDP scenario, peer may retransmit the finished message even if the local endpoint is connected
      * Therefore, the hsCtx is not released in the UDP scenario */
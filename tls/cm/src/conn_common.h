@@ -30,7 +30,7 @@ extern "C" {
 
 typedef int32_t (*ManageEventProcess)(HITLS_Ctx *ctx);
 
-typedef int32_t (*WriteEventProcess)(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen);
+typedef int32_t (*WriteEventProcess)(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen);
 
 typedef int32_t (*ReadEventProcess)(HITLS_Ctx *ctx, uint8_t *data, uint32_t bufSize, uint32_t *readLen);
 
@@ -23,6 +23,9 @@
 #include "session.h"
 #endif
 #include "cert_method.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include "rec.h"
+#endif
 
 #ifdef HITLS_TLS_CONNECTION_INFO_NEGOTIATION
 int32_t HITLS_GetNegotiatedVersion(const HITLS_Ctx *ctx, uint16_t *version)
@@ -97,6 +100,25 @@ int32_t HITLS_IsDtls(const HITLS_Ctx *ctx, uint8_t *isDtls)
     return HITLS_CFG_IsDtls(&(ctx->config.tlsConfig), isDtls);
 }
 #endif
+#ifdef HITLS_TLS_FEATURE_KTLS
+int32_t HITLS_IsKtlsSend(const HITLS_Ctx *ctx, uint8_t *isKtls)
+{
+    if (ctx == NULL || isKtls == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    *isKtls = REC_IsKtlsSend(ctx) ? 1 : 0;
+    return HITLS_SUCCESS;
+}
+
+int32_t HITLS_IsKtlsRecv(const HITLS_Ctx *ctx, uint8_t *isKtls)
+{
+    if (ctx == NULL || isKtls == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    *isKtls = REC_IsKtlsRecv(ctx) ? 1 : 0;
+    return HITLS_SUCCESS;
+}
+#endif
 
 #ifdef HITLS_TLS_FEATURE_SESSION
 int32_t HITLS_IsSessionReused(HITLS_Ctx *ctx, uint8_t *isReused)
@@ -484,6 +506,33 @@ int32_t HITLS_GetMaxSendFragment(const HITLS_Ctx *ctx, uint16_t *maxSendFragment
 }
 #endif
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+int32_t HITLS_SetRecordSizeLimit(HITLS_Ctx *ctx, uint16_t recordSizeLimit)
+{
+    if (ctx == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    return HITLS_CFG_SetRecordSizeLimit(&(ctx->config.tlsConfig), recordSizeLimit);
+}
+
+int32_t HITLS_GetRecordSizeLimit(const HITLS_Ctx *ctx, uint16_t *recordSizeLimit)
+{
+    if (ctx == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    return HITLS_CFG_GetRecordSizeLimit(&(ctx->config.tlsConfig), recordSizeLimit);
+}
+
+int32_t HITLS_GetPeerRecordSizeLimit(const HITLS_Ctx *ctx, uint16_t *recordSizeLimit)
+{
+    if (ctx == NULL || recordSizeLimit == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    *recordSizeLimit = ctx->negotiatedInfo.peerRecordSizeLimit;
+    return HITLS_SUCCESS;
+}
+#endif
+
 #ifdef HITLS_TLS_FEATURE_SESSION_TICKET
 int32_t HITLS_SetTicketNums(HITLS_Ctx *ctx, uint32_t ticketNums)
 {
@@ -507,6 +507,67 @@ int32_t HITLS_Peek(HITLS_Ctx *ctx, uint8_t *data, uint32_t bufSize, uint32_t *re
     return ret;
 }
 
+int32_t HITLS_PeekReadBuffer(HITLS_Ctx *ctx, const uint8_t **buf, uint32_t *len)
+{
+    if (ctx == NULL || buf == NULL || len == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    if (APP_GetReadPendingBytes(ctx) == 0) {
+        /* Peeking keeps the decrypted record in the record layer, from which it is lent out */
+        uint8_t firstByte = 0;
+        uint32_t readLen = 0;
+        int32_t ret = HITLS_Peek(ctx, &firstByte, sizeof(firstByte), &readLen);
+        if (ret != HITLS_SUCCESS) {
+            return ret;
+        }
+    }
+    return REC_PeekAppBuffer(ctx, buf, len);
+}
+
+int32_t HITLS_ConsumeReadBuffer(HITLS_Ctx *ctx, uint32_t len)
+{
+    if (ctx == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    return REC_ConsumeAppBuffer(ctx, len);
+}
+
+int32_t HITLS_Readv(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *readLen)
+{
+    if (ctx == NULL || iov == NULL || iovCnt == 0 || readLen == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    uint32_t first = iovCnt;
+    for (uint32_t i = 0; i < iovCnt; i++) {
+        if (iov[i].len == 0) {
+            continue;
+        }
+        if (iov[i].base == NULL) {
+            return HITLS_NULL_INPUT;
+        }
+        first = (first == iovCnt) ? i : first;
+    }
+    if (first == iovCnt) {
+        return HITLS_APP_ERR_ZERO_READ_BUF_LEN;
+    }
+    /* The record is decrypted directly into the first segment if the segment can hold it */
+    uint32_t len = 0;
+    int32_t ret = HITLS_Read(ctx, iov[first].base, iov[first].len, &len);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    uint32_t restLen = 0;
+    if (len == iov[first].len && first + 1 < iovCnt) {
+        /* Scatter the rest of the record into the following segments */
+        ret = APP_Readv(ctx, &iov[first + 1], iovCnt - first - 1, &restLen);
+        if (ret != HITLS_SUCCESS) {
+            return ret;
+        }
+    }
+    *readLen = len + restLen;
+    return HITLS_SUCCESS;
+}
+
 int32_t HITLS_ReadHasPending(const HITLS_Ctx *ctx, uint8_t *isPending)
 {
     if (ctx == NULL || isPending == NULL) {
@@ -37,16 +37,24 @@ int32_t HITLS_GetMaxWriteSize(const HITLS_Ctx *ctx, uint32_t *len)
     return APP_GetMaxWriteSize(ctx, len);
 }
 
-static int32_t WriteEventInIdleState(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t ConnAppWrite(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
+{
+    if (iovCnt == 1) {
+        return APP_Write(ctx, (const uint8_t *)iov->base, iov->len, writeLen);
+    }
+    return APP_Writev(ctx, iov, iovCnt, writeLen);
+}
+
+static int32_t WriteEventInIdleState(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
 {
     (void)ctx;
-    (void)data;
-    (void)dataLen;
+    (void)iov;
+    (void)iovCnt;
     (void)writeLen;
     return HITLS_CM_LINK_UNESTABLISHED;
 }
 
-static int32_t WriteEventInTransportingState(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t WriteEventInTransportingState(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
 {
     int32_t ret;
     int32_t alertRet;
@@ -59,7 +67,7 @@ static int32_t WriteEventInTransportingState(HITLS_Ctx *ctx, const uint8_t *data
             return ret;
         }
 #endif
-        ret = APP_Write(ctx, data, dataLen, writeLen);
+        ret = ConnAppWrite(ctx, iov, iovCnt, writeLen);
         if (ret == HITLS_SUCCESS) {
             /* The message is sent successfully */
             break;
@@ -92,7 +100,7 @@ static int32_t WriteEventInTransportingState(HITLS_Ctx *ctx, const uint8_t *data
     return ret;
 }
 
-static int32_t WriteEventInHandshakingState(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t WriteEventInHandshakingState(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
 {
     // The link is being established. Therefore, the link establishment is triggered first. If the link is successfully
     // established, the message is directly sent.
@@ -101,16 +109,16 @@ static int32_t WriteEventInHandshakingState(HITLS_Ctx *ctx, const uint8_t *data,
         return ret;
     }
 
-    return WriteEventInTransportingState(ctx, data, dataLen, writeLen);
+    return WriteEventInTransportingState(ctx, iov, iovCnt, writeLen);
 }
 
-static int32_t WriteEventInRenegotiationState(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t WriteEventInRenegotiationState(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
 {
 #ifdef HITLS_TLS_FEATURE_RENEGOTIATION
     int32_t ret;
     if (ctx->recCtx->pendingData != NULL) {
         // Send the app data first.
-        return WriteEventInTransportingState(ctx, data, dataLen, writeLen);
+        return WriteEventInTransportingState(ctx, iov, iovCnt, writeLen);
     }
     do {
         /* If an unexpected message is received, the system ignores the return value and continues to establish a link.
@@ -128,11 +136,11 @@ static int32_t WriteEventInRenegotiationState(HITLS_Ctx *ctx, const uint8_t *dat
          */
     }
 
-    return WriteEventInTransportingState(ctx, data, dataLen, writeLen);
+    return WriteEventInTransportingState(ctx, iov, iovCnt, writeLen);
 #else
     (void)ctx;
-    (void)data;
-    (void)dataLen;
+    (void)iov;
+    (void)iovCnt;
     (void)writeLen;
     BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15583, BSL_LOG_LEVEL_FATAL, BSL_LOG_BINLOG_TYPE_RUN,
         "invalid conn states %d", CM_STATE_RENEGOTIATION, NULL, NULL, NULL);
@@ -140,21 +148,21 @@ static int32_t WriteEventInRenegotiationState(HITLS_Ctx *ctx, const uint8_t *dat
 #endif
 }
 
-static int32_t WriteEventInAlertedState(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t WriteEventInAlertedState(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
 {
     (void)ctx;
-    (void)data;
-    (void)dataLen;
+    (void)iov;
+    (void)iovCnt;
     (void)writeLen;
     // Directly return a message indicating that the link status is abnormal.
     return HITLS_CM_LINK_FATAL_ALERTED;
 }
 
-static int32_t WriteEventInClosedState(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t WriteEventInClosedState(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
 {
     if ((ctx->shutdownState & HITLS_SENT_SHUTDOWN) == 0) {
         ALERT_CleanInfo(ctx);
-        int ret = APP_Write(ctx, data, dataLen, writeLen);
+        int ret = ConnAppWrite(ctx, iov, iovCnt, writeLen);
         if (ret == HITLS_SUCCESS || ret == HITLS_REC_NORMAL_IO_BUSY) {
             return ret;
         }
@@ -202,11 +210,9 @@ static int32_t HITLS_WritePreporcess(HITLS_Ctx *ctx)
 #endif
 }
 
-int32_t HITLS_Write(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+static int32_t WriteProcess(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
 {
-    if (ctx == NULL || data == NULL || dataLen == 0 || writeLen == NULL) {
-        return HITLS_NULL_INPUT;
-    }
+    *writeLen = 0;
     ctx->allowAppOut = false;
 
     int32_t ret = HITLS_WritePreporcess(ctx);
@@ -234,9 +240,39 @@ int32_t HITLS_Write(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint3
 
     WriteEventProcess proc = writeEventProcess[GetConnState(ctx)];
 
-    ret = proc(ctx, data, dataLen, writeLen);
-    if (ret != HITLS_SUCCESS) {
+    ret = proc(ctx, iov, iovCnt, writeLen);
+    /* If I/O is busy, writeLen keeps the length that has been sent by the multi-record write */
+    if (ret != HITLS_SUCCESS && ret != HITLS_REC_NORMAL_IO_BUSY) {
         *writeLen = 0;
     }
     return ret;
 }
+
+int32_t HITLS_Write(HITLS_Ctx *ctx, const uint8_t *data, uint32_t dataLen, uint32_t *writeLen)
+{
+    if (ctx == NULL || data == NULL || dataLen == 0 || writeLen == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    HITLS_Iovec iov = { (void *)(uintptr_t)data, dataLen };
+    return WriteProcess(ctx, &iov, 1, writeLen);
+}
+
+int32_t HITLS_Writev(HITLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t *writeLen)
+{
+    if (ctx == NULL || iov == NULL || iovCnt == 0 || writeLen == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    bool isEmpty = true;
+    for (uint32_t i = 0; i < iovCnt; i++) {
+        if (iov[i].len != 0) {
+            if (iov[i].base == NULL) {
+                return HITLS_NULL_INPUT;
+            }
+            isEmpty = false;
+        }
+    }
+    if (isEmpty) {
+        return HITLS_NULL_INPUT;
+    }
+    return WriteProcess(ctx, iov, iovCnt, writeLen);
+}
@@ -57,6 +57,11 @@
 #define MIN_MAX_SEND_FRAGMENT 512u
 #endif
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+#define MAX_RECORD_SIZE_LIMIT 16385u
+#define MIN_RECORD_SIZE_LIMIT 64u
+#endif
+
 #ifdef HITLS_TLS_EXTENSION_CERT_AUTH
 static void HitlsTrustedCANodeFree(void *caNode)
 {
@@ -154,6 +159,9 @@ static void ShallowCopy(HITLS_Ctx *ctx, const HITLS_Config *srcConfig)
 #ifdef HITLS_TLS_FEATURE_MAX_SEND_FRAGMENT
     destConfig->maxSendFragment = srcConfig->maxSendFragment;
 #endif
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+    destConfig->recordSizeLimit = srcConfig->recordSizeLimit;
+#endif
 #ifdef HITLS_TLS_FEATURE_RENEGOTIATION
     destConfig->isSupportRenegotiation = srcConfig->isSupportRenegotiation;
     destConfig->allowClientRenegotiate = srcConfig->allowClientRenegotiate;
@@ -2118,4 +2126,32 @@ int32_t HITLS_CFG_GetMaxSendFragment(const HITLS_Config *config, uint16_t *maxSe
 
     return HITLS_SUCCESS;
 }
+#endif
+
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+int32_t HITLS_CFG_SetRecordSizeLimit(HITLS_Config *config, uint16_t recordSizeLimit)
+{
+    if (config == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+
+    /* RFC 8449: the limit is at least 64 bytes, and covers the content type of TLS1.3 */
+    if (recordSizeLimit != 0 && (recordSizeLimit > MAX_RECORD_SIZE_LIMIT || recordSizeLimit < MIN_RECORD_SIZE_LIMIT)) {
+        BSL_ERR_PUSH_ERROR(HITLS_CONFIG_INVALID_LENGTH);
+        return HITLS_CONFIG_INVALID_LENGTH;
+    }
+
+    config->recordSizeLimit = recordSizeLimit;
+    return HITLS_SUCCESS;
+}
+
+int32_t HITLS_CFG_GetRecordSizeLimit(const HITLS_Config *config, uint16_t *recordSizeLimit)
+{
+    if (config == NULL || recordSizeLimit == NULL) {
+        return HITLS_NULL_INPUT;
+    }
+    *recordSizeLimit = config->recordSizeLimit;
+
+    return HITLS_SUCCESS;
+}
 #endif
\ No newline at end of file
@@ -589,6 +589,31 @@ int32_t SAL_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName,
     return CheckCallBackRetVal(HITLS_CRYPT_CALLBACK_ENCRYPT, ret, BINLOG_ID15096, HITLS_CRYPT_ERR_ENCRYPT);
 }
 
+int32_t SAL_CRYPT_EncryptBatch(HITLS_Lib_Ctx *libCtx, const char *attrName,
+    const HITLS_CipherParameters *cipher, HITLS_AeadRecord *records, uint32_t num)
+{
+#ifdef HITLS_TLS_FEATURE_PROVIDER
+    int32_t ret = HITLS_CRYPT_EncryptBatch(libCtx, attrName, cipher, records, num);
+#else
+    (void)libCtx;
+    (void)attrName;
+    if (g_cryptBaseMethod.encrypt == NULL) {
+        return HITLS_CRYPT_ERR_ENCRYPT;
+    }
+    int32_t ret = HITLS_SUCCESS;
+    HITLS_CipherParameters recordCipher = *cipher;
+    for (uint32_t i = 0; i < num && ret == HITLS_SUCCESS; i++) {
+        recordCipher.iv = records[i].iv;
+        recordCipher.ivLen = records[i].ivLen;
+        recordCipher.aad = (uint8_t *)(uintptr_t)records[i].aad;
+        recordCipher.aadLen = records[i].aadLen;
+        ret = g_cryptBaseMethod.encrypt(&recordCipher, records[i].in, records[i].inLen, records[i].out,
+            &records[i].outLen);
+    }
+#endif
+    return CheckCallBackRetVal(HITLS_CRYPT_CALLBACK_ENCRYPT, ret, BINLOG_ID15096, HITLS_CRYPT_ERR_ENCRYPT);
+}
+
 int32_t SAL_CRYPT_Decrypt(HITLS_Lib_Ctx *libCtx, const char *attrName,
     const HITLS_CipherParameters *cipher, const uint8_t *in, uint32_t inLen,
     uint8_t *out, uint32_t *outLen)
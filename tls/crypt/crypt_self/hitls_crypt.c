@@ -318,41 +318,6 @@ int32_t HITLS_CRYPT_Digest(HITLS_Lib_Ctx *libCtx, const char *attrName,
 #endif // HITLS_CRYPTO_MD
 }
 
-static int32_t SpecialModeEncryptPreSolve(CRYPT_EAL_CipherCtx *ctx, const HITLS_CipherParameters *cipher,
-    uint64_t inLen)
-{
-#ifdef HITLS_CRYPTO_CIPHER
-    int32_t ret = CRYPT_SUCCESS;
-
-    if (IsCipherCCM8(cipher->algo)) {
-        uint32_t tagLen = CCM8_TLS_TAG_LEN;
-        ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_TAGLEN, &tagLen, sizeof(tagLen));
-        if (ret != CRYPT_SUCCESS) {
-            return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16635, "SET_TAGLEN fail");
-        }
-    }
-    // In the case of CCM processing, msgLen needs to be set.
-    if ((cipher->algo == HITLS_CIPHER_AES_128_CCM) || (cipher->algo == HITLS_CIPHER_AES_128_CCM8) ||
-        (cipher->algo == HITLS_CIPHER_AES_256_CCM) || (cipher->algo == HITLS_CIPHER_AES_256_CCM8)) {
-        ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_MSGLEN, &inLen, sizeof(inLen));
-        if (ret != CRYPT_SUCCESS) {
-            return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16636, "SET_MSGLEN fail");
-        }
-    }
-
-    if (cipher->type == HITLS_AEAD_CIPHER) {
-        ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_AAD, cipher->aad, cipher->aadLen);
-    }
-
-    return ret;
-#else // HITLS_CRYPTO_CIPHER
-    (void)ctx;
-    (void)cipher;
-    (void)inLen;
-    return CRYPT_EAL_ALG_NOT_SUPPORT;
-#endif // HITLS_CRYPTO_CIPHER
-}
-
 #ifdef HITLS_CRYPTO_CIPHER
 static int32_t GetCipherInitCtx(HITLS_Lib_Ctx *libCtx, const char *attrName,
     const HITLS_CipherParameters *cipher, CRYPT_EAL_CipherCtx **ctx, bool enc)
@@ -371,6 +336,79 @@ static int32_t GetCipherInitCtx(HITLS_Lib_Ctx *libCtx, const char *attrName,
     }
     return CRYPT_SUCCESS;
 }
+
+/* The nonce of each record is passed to the one-shot interface, the ctx only needs to be initialized once. */
+static int32_t GetAeadInitCtx(HITLS_Lib_Ctx *libCtx, const char *attrName,
+    const HITLS_CipherParameters *cipher, CRYPT_EAL_CipherCtx **ctx, bool enc)
+{
+    if (*ctx != NULL) {
+        return CRYPT_SUCCESS;
+    }
+    return GetCipherInitCtx(libCtx, attrName, cipher, ctx, enc);
+}
+
+static int32_t AeadEncrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
+    const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
+{
+    uint32_t tagLen = IsCipherCCM8(cipher->algo) ? CCM8_TLS_TAG_LEN : CCM_TLS_TAG_LEN;
+    if (*outLen < tagLen || *outLen - tagLen < inLen) {
+        return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_ENCRYPT, BINLOG_ID16643, "outLen less than cipherLen");
+    }
+    CRYPT_EAL_CipherCtx *tmpCtx = NULL;
+    CRYPT_EAL_CipherCtx **ctx = cipher->ctx == NULL ? &tmpCtx : (CRYPT_EAL_CipherCtx **)cipher->ctx;
+    int32_t ret = GetAeadInitCtx(libCtx, attrName, cipher, ctx, true);
+    if (ret != CRYPT_SUCCESS) {
+        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16640, "GetCipherInitCtx fail");
+    }
+
+    CRYPT_ConstData nonce = {cipher->iv, cipher->ivLen};
+    CRYPT_ConstData aad = {cipher->aad, cipher->aadLen};
+    CRYPT_ConstData plain = {in, inLen};
+    CRYPT_Data tag = {out + inLen, tagLen};
+    ret = CRYPT_EAL_CipherAeadSeal(*ctx, &nonce, &aad, &plain, out, &tag);
+    if (ret != CRYPT_SUCCESS) {
+        CRYPT_EAL_CipherFreeCtx(*ctx);
+        *ctx = NULL;
+        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16641, "AeadSeal fail");
+    }
+    *outLen = inLen + tagLen;
+    if (cipher->ctx == NULL) {
+        CRYPT_EAL_CipherFreeCtx(*ctx);
+    }
+    return HITLS_SUCCESS;
+}
+
+static int32_t AeadDecrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
+    const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
+{
+    uint32_t tagLen = IsCipherCCM8(cipher->algo) ? CCM8_TLS_TAG_LEN : CCM_TLS_TAG_LEN;
+    if (inLen < tagLen || *outLen < inLen - tagLen) {
+        return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_DECRYPT, BINLOG_ID16646, "decrypt err");
+    }
+    CRYPT_EAL_CipherCtx *tmpCtx = NULL;
+    CRYPT_EAL_CipherCtx **ctx = cipher->ctx == NULL ? &tmpCtx : (CRYPT_EAL_CipherCtx **)cipher->ctx;
+    int32_t ret = GetAeadInitCtx(libCtx, attrName, cipher, ctx, false);
+    if (ret != CRYPT_SUCCESS) {
+        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16654, "GetCipherInitCtx fail");
+    }
+
+    CRYPT_ConstData nonce = {cipher->iv, cipher->ivLen};
+    CRYPT_ConstData aad = {cipher->aad, cipher->aadLen};
+    CRYPT_ConstData cipherText = {in, inLen - tagLen};
+    CRYPT_ConstData tag = {in + cipherText.len, tagLen};
+    ret = CRYPT_EAL_CipherAeadOpen(*ctx, &nonce, &aad, &cipherText, out, &tag);
+    if (cipher->ctx == NULL) {
+        CRYPT_EAL_CipherFreeCtx(*ctx);
+    }
+    if (ret == CRYPT_MODES_TAG_VERIFY_FAIL) {
+        return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_DECRYPT, BINLOG_ID16648, "verify tag fail");
+    }
+    if (ret != CRYPT_SUCCESS) {
+        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16645, "AeadOpen fail");
+    }
+    *outLen = cipherText.len;
+    return HITLS_SUCCESS;
+}
 #endif
 
 int32_t HITLS_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
@@ -380,6 +418,9 @@ int32_t HITLS_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const H
     if (cipher == NULL) {
         return RETURN_ERROR_NUMBER_PROCESS(HITLS_NULL_INPUT, BINLOG_ID17313, "encrypt null input");
     }
+    if (cipher->type == HITLS_AEAD_CIPHER) {
+        return AeadEncrypt(libCtx, attrName, cipher, in, inLen, out, outLen);
+    }
     CRYPT_EAL_CipherCtx *tmpCtx = NULL;
     CRYPT_EAL_CipherCtx **ctx = cipher->ctx == NULL ? &tmpCtx : (CRYPT_EAL_CipherCtx **)cipher->ctx;
     int32_t ret = GetCipherInitCtx(libCtx, attrName, cipher, ctx, true);
@@ -387,13 +428,6 @@ int32_t HITLS_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const H
         return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16640, "GetCipherInitCtx fail");
     }
 
-    ret = SpecialModeEncryptPreSolve(*ctx, cipher, inLen);
-    if (ret != CRYPT_SUCCESS) {
-        CRYPT_EAL_CipherFreeCtx(*ctx);
-        *ctx = NULL;
-        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16641, "SpecialModeEncryptPreSolve fail");
-    }
-
     uint32_t cipherLen = *outLen;
     ret = CRYPT_EAL_CipherUpdate(*ctx, in, inLen, out, &cipherLen);
     if (ret != CRYPT_SUCCESS) {
@@ -409,12 +443,7 @@ int32_t HITLS_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const H
     }
 
     uint32_t finLen = *outLen - cipherLen;
-    if (cipher->type == HITLS_AEAD_CIPHER) {
-        finLen = IsCipherCCM8(cipher->algo) ? CCM8_TLS_TAG_LEN : CCM_TLS_TAG_LEN;
-        ret = CRYPT_EAL_CipherCtrl(*ctx, CRYPT_CTRL_GET_TAG, out + cipherLen, finLen);
-    } else {
-        ret = CRYPT_EAL_CipherFinal(*ctx, out + cipherLen, &finLen);
-    }
+    ret = CRYPT_EAL_CipherFinal(*ctx, out + cipherLen, &finLen);
     if (ret != CRYPT_SUCCESS) {
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16644, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "%d , get finLen fail", cipher->type, 0, 0, 0);
@@ -439,47 +468,6 @@ int32_t HITLS_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const H
 #endif // HITLS_CRYPTO_CIPHER
 }
 
-static int32_t AeadDecrypt(CRYPT_EAL_CipherCtx *ctx, const HITLS_CipherParameters *cipher, const uint8_t *in,
-    uint32_t inLen, uint8_t *out, uint32_t *outLen)
-{
-#ifdef HITLS_CRYPTO_CIPHER
-    int32_t ret;
-    uint32_t tagLen = IsCipherCCM8(cipher->algo) ?
-        CCM8_TLS_TAG_LEN : CCM_TLS_TAG_LEN;
-    uint32_t cipherLen = inLen - tagLen;
-    uint32_t plainLen = *outLen;
-
-    ret = CRYPT_EAL_CipherUpdate(ctx, in, cipherLen, out, &plainLen);
-    if (ret != CRYPT_SUCCESS) {
-        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16645, "CipherUpdate fail");
-    }
-
-    if (plainLen != cipherLen) {
-        return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_DECRYPT, BINLOG_ID16646, "decrypt err");
-    }
-
-    uint8_t tag[16u] = {0};
-    ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_GET_TAG, tag, tagLen);
-    if (ret != HITLS_SUCCESS) {
-        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16647, "GET_TAG err");
-    }
-
-    if (memcmp(tag, in + cipherLen, tagLen) != 0) {
-        return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_DECRYPT, BINLOG_ID16648, "memcmp tag fail");
-    }
-
-    *outLen = plainLen;
-    return HITLS_SUCCESS;
-#else // HITLS_CRYPTO_CIPHER
-    (void)cipher;
-    (void)out;
-    (void)outLen;
-    (void)in;
-    (void)inLen;
-    return CRYPT_EAL_ALG_NOT_SUPPORT;
-#endif // HITLS_CRYPTO_CIPHER
-}
-
 #ifdef HITLS_TLS_SUITE_CIPHER_CBC
 int32_t CbcDecrypt(CRYPT_EAL_CipherCtx *ctx, const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
 {
@@ -517,75 +505,98 @@ int32_t CbcDecrypt(CRYPT_EAL_CipherCtx *ctx, const uint8_t *in, uint32_t inLen,
 #endif /* HITLS_TLS_SUITE_CIPHER_CBC */
 
 #ifdef HITLS_CRYPTO_CIPHER
-static int32_t DEFAULT_DecryptPrepare(CRYPT_EAL_CipherCtx *ctx, const HITLS_CipherParameters *cipher, uint32_t inLen)
+#define AEAD_SEAL_BATCH_NUM 8u /* Number of records passed to one call of CRYPT_EAL_CipherAeadSealBatch */
+
+static int32_t AeadSealBatch(CRYPT_EAL_CipherCtx *ctx, uint32_t tagLen, HITLS_AeadRecord *records, uint32_t num)
 {
-    int32_t ret = CRYPT_SUCCESS;
-    uint32_t tagLen = CCM_TLS_TAG_LEN;
-    if (IsCipherCCM8(cipher->algo)) {
-        tagLen = CCM8_TLS_TAG_LEN;
-        /* The default value of tagLen is 16 for the ctx generated by the CRYPT_EAL_CipherNewCtx.
-           Therefore, need to set this parameter again. */
-        ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_TAGLEN, &tagLen, sizeof(tagLen));
-        if (ret != CRYPT_SUCCESS) {
-            CRYPT_EAL_CipherFreeCtx(ctx);
-            return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16652, "CipherUpdate fail");
+    CRYPT_EAL_AeadRecord sealRecords[AEAD_SEAL_BATCH_NUM];
+    for (uint32_t i = 0; i < num; i++) {
+        HITLS_AeadRecord *rec = &records[i];
+        if (rec->outLen < tagLen || rec->outLen - tagLen < rec->inLen) {
+            return RETURN_ERROR_NUMBER_PROCESS(HITLS_CRYPT_ERR_ENCRYPT, BINLOG_ID16635, "outLen less than cipherLen");
         }
+        sealRecords[i].nonce = (CRYPT_ConstData){rec->iv, rec->ivLen};
+        sealRecords[i].aad = (CRYPT_ConstData){rec->aad, rec->aadLen};
+        sealRecords[i].in = (CRYPT_ConstData){rec->in, rec->inLen};
+        sealRecords[i].out = rec->out;
+        sealRecords[i].tag = (CRYPT_Data){rec->out + rec->inLen, tagLen};
     }
-    if ((cipher->algo == HITLS_CIPHER_AES_128_CCM) || (cipher->algo == HITLS_CIPHER_AES_128_CCM8) ||
-        (cipher->algo == HITLS_CIPHER_AES_256_CCM) || (cipher->algo == HITLS_CIPHER_AES_256_CCM8)) {
-        // The length of the decrypted ciphertext consists of msgLen and tagLen, so tagLen needs to be subtracted.
-        uint64_t msgLen = inLen - tagLen;
-        ret = CRYPT_EAL_CipherCtrl(ctx, CRYPT_CTRL_SET_MSGLEN, &msgLen, sizeof(msgLen));
-        if (ret != CRYPT_SUCCESS) {
-            CRYPT_EAL_CipherFreeCtx(ctx);
-            return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16653, "CipherUpdate fail");
-        }
+    int32_t ret = CRYPT_EAL_CipherAeadSealBatch(ctx, sealRecords, num);
+    if (ret != CRYPT_SUCCESS) {
+        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16636, "AeadSealBatch fail");
     }
-    return ret;
+    for (uint32_t i = 0; i < num; i++) {
+        records[i].outLen = records[i].inLen + tagLen;
+    }
+    return HITLS_SUCCESS;
 }
 #endif
 
-int32_t HITLS_CRYPT_Decrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
-    const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
+int32_t HITLS_CRYPT_EncryptBatch(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
+    HITLS_AeadRecord *records, uint32_t num)
 {
 #ifdef HITLS_CRYPTO_CIPHER
-    if (cipher == NULL) {
-        return RETURN_ERROR_NUMBER_PROCESS(HITLS_NULL_INPUT, BINLOG_ID17312, "encrypt null input");
+    if (cipher == NULL || records == NULL || num == 0 || cipher->type != HITLS_AEAD_CIPHER) {
+        return RETURN_ERROR_NUMBER_PROCESS(HITLS_NULL_INPUT, BINLOG_ID16647, "encrypt batch input error");
     }
     CRYPT_EAL_CipherCtx *tmpCtx = NULL;
     CRYPT_EAL_CipherCtx **ctx = cipher->ctx == NULL ? &tmpCtx : (CRYPT_EAL_CipherCtx **)cipher->ctx;
-    int32_t ret = GetCipherInitCtx(libCtx, attrName, cipher, ctx, false);
+    /* The handle is initialized with the nonce of the first record, which is replaced by each record */
+    HITLS_CipherParameters initCipher = *cipher;
+    initCipher.iv = records[0].iv;
+    initCipher.ivLen = records[0].ivLen;
+    int32_t ret = GetAeadInitCtx(libCtx, attrName, &initCipher, ctx, true);
     if (ret != CRYPT_SUCCESS) {
-        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16654, "CipherUpdate fail");
+        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16640, "GetCipherInitCtx fail");
     }
-
-    ret = DEFAULT_DecryptPrepare(*ctx, cipher, inLen);
-    if (ret != CRYPT_SUCCESS) {
+    uint32_t tagLen = IsCipherCCM8(cipher->algo) ? CCM8_TLS_TAG_LEN : CCM_TLS_TAG_LEN;
+    for (uint32_t done = 0; done < num && ret == HITLS_SUCCESS; done += AEAD_SEAL_BATCH_NUM) {
+        uint32_t batchNum = (num - done > AEAD_SEAL_BATCH_NUM) ? AEAD_SEAL_BATCH_NUM : (num - done);
+        ret = AeadSealBatch(*ctx, tagLen, &records[done], batchNum);
+    }
+    if (ret != HITLS_SUCCESS || cipher->ctx == NULL) {
+        CRYPT_EAL_CipherFreeCtx(*ctx);
         *ctx = NULL;
-        return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16655, "CipherUpdate fail");
     }
+    return ret;
+#else // HITLS_CRYPTO_CIPHER
+    (void)cipher;
+    (void)records;
+    (void)num;
+    (void)libCtx;
+    (void)attrName;
+    return CRYPT_EAL_ALG_NOT_SUPPORT;
+#endif // HITLS_CRYPTO_CIPHER
+}
 
+int32_t HITLS_CRYPT_Decrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
+    const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen)
+{
+#ifdef HITLS_CRYPTO_CIPHER
+    if (cipher == NULL) {
+        return RETURN_ERROR_NUMBER_PROCESS(HITLS_NULL_INPUT, BINLOG_ID17312, "encrypt null input");
+    }
     if (cipher->type == HITLS_AEAD_CIPHER) {
-        ret = CRYPT_EAL_CipherCtrl(*ctx, CRYPT_CTRL_SET_AAD, cipher->aad, cipher->aadLen);
+        return AeadDecrypt(libCtx, attrName, cipher, in, inLen, out, outLen);
+    }
+#ifdef HITLS_TLS_SUITE_CIPHER_CBC
+    if (cipher->type == HITLS_CBC_CIPHER) {
+        CRYPT_EAL_CipherCtx *tmpCtx = NULL;
+        CRYPT_EAL_CipherCtx **ctx = cipher->ctx == NULL ? &tmpCtx : (CRYPT_EAL_CipherCtx **)cipher->ctx;
+        int32_t ret = GetCipherInitCtx(libCtx, attrName, cipher, ctx, false);
         if (ret != CRYPT_SUCCESS) {
-            CRYPT_EAL_CipherFreeCtx(*ctx);
-            *ctx = NULL;
-            return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16656, "SET_AAD fail");
+            return RETURN_ERROR_NUMBER_PROCESS(ret, BINLOG_ID16654, "GetCipherInitCtx fail");
         }
-        ret = AeadDecrypt(*ctx, cipher, in, inLen, out, outLen);
-#ifdef HITLS_TLS_SUITE_CIPHER_CBC
-    } else if (cipher->type == HITLS_CBC_CIPHER) {
         ret = CbcDecrypt(*ctx, in, inLen, out, outLen);
-#endif
-    } else {
-        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16657, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
-            "not support other cipher type", 0, 0, 0, 0);
-        ret = HITLS_CRYPT_ERR_DECRYPT;
-    }
-    if (cipher->ctx == NULL) {
-        CRYPT_EAL_CipherFreeCtx(*ctx);
+        if (cipher->ctx == NULL) {
+            CRYPT_EAL_CipherFreeCtx(*ctx);
+        }
+        return ret;
     }
-    return ret;
+#endif
+    BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16657, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+        "not support other cipher type", 0, 0, 0, 0);
+    return HITLS_CRYPT_ERR_DECRYPT;
 #else
     (void)cipher;
     (void)in;
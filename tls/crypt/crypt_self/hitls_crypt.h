@@ -104,6 +104,24 @@ int32_t HITLS_CRYPT_Digest(HITLS_Lib_Ctx *libCtx, const char *attrName, HITLS_Ha
 int32_t HITLS_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
     const uint8_t *in, uint32_t inLen, uint8_t *out, uint32_t *outLen);
 
+/**
+ * @brief Encrypt several records with the same AEAD key in one call.
+ *
+ * The records are sealed in batches by the one-shot AEAD interface of the cipher handle in cipher->ctx, which is
+ * initialized with the key on the first call. The iv and aad in cipher are not used.
+ *
+ * @param libCtx     [IN] Library context, used to manage cryptographic operations.
+ * @param attrName   [IN] Attribute name, which may be used for specific configuration.
+ * @param cipher     [IN] Key parameters for the encryption operation.
+ * @param records    [IN/OUT] Records to be encrypted, each with its own nonce and additional data.
+ * @param num        [IN] Number of the records.
+ *
+ * @retval HITLS_SUCCESS                succeeded.
+ * @retval Other                        failure
+ */
+int32_t HITLS_CRYPT_EncryptBatch(HITLS_Lib_Ctx *libCtx, const char *attrName, const HITLS_CipherParameters *cipher,
+    HITLS_AeadRecord *records, uint32_t num);
+
 /**
  * @brief Perform decryption operation.
  *
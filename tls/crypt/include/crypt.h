@@ -330,6 +330,24 @@ int32_t SAL_CRYPT_Encrypt(HITLS_Lib_Ctx *libCtx, const char *attrName,
     const HITLS_CipherParameters *cipher, const uint8_t *in, uint32_t inLen,
     uint8_t *out, uint32_t *outLen);
 
+/**
+ * @brief Encrypt several records with the same AEAD key. If the encryption callback is registered instead of the
+ *        provider, the records are encrypted by the callback one by one.
+ *
+ * @param libCtx     [IN] Library context, used to manage cryptographic operations.
+ * @param attrName   [IN] Attribute name, used to configure the cryptographic
+ *                      algorithm provided by the algorithm provider
+ * @param cipher  [IN] Key parameters, the iv and aad are not used
+ * @param records [IN/OUT] Records to be encrypted, each with its own nonce and additional data
+ * @param num     [IN] Number of the records
+ *
+ * @retval HITLS_SUCCESS                succeeded.
+ * @retval HITLS_UNREGISTERED_CALLBACK  Unregistered callback
+ * @retval HITLS_CRYPT_ERR_ENCRYPT      Encryption failed.
+ */
+int32_t SAL_CRYPT_EncryptBatch(HITLS_Lib_Ctx *libCtx, const char *attrName,
+    const HITLS_CipherParameters *cipher, HITLS_AeadRecord *records, uint32_t num);
+
 /**
  * @brief Decrypt
  * 
@@ -229,6 +229,19 @@ uint16_t *CheckSupportSignAlgorithms(const TLS_Ctx *ctx, const uint16_t *signAlg
 
 uint32_t HS_GetExtensionTypeId(uint32_t hsExtensionsType);
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+/**
+ * @brief   Obtain the record_size_limit advertised to the peer. The configured limit is capped to the maximum
+ *          plaintext length of the version.
+ *
+ * @param   ctx [IN] TLS context
+ * @param   version [IN] Protocol version, the maximum version offered by the client or the negotiated version
+ *
+ * @return  Limit of the records received, 0 indicates that the extension is not sent
+ */
+uint16_t HS_GetLocalRecordSizeLimit(const TLS_Ctx *ctx, uint16_t version);
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
+
 int32_t HS_CheckReceivedExtension(HITLS_Ctx *ctx, HS_MsgType hsType, uint64_t hsMsgExtensionsMask,
     uint64_t hsMsgAllowedExtensionsMask);
 
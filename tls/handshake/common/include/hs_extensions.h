@@ -24,6 +24,10 @@ extern "C" {
 
 #define HS_EX_HEADER_LEN 4u
 
+/* RFC 8449: bounds of the record_size_limit, the upper bound includes the content type of TLS1.3 */
+#define HS_MIN_RECORD_SIZE_LIMIT 64u
+#define HS_MAX_TLS12_RECORD_SIZE_LIMIT 16384u
+
 /* Handshake Extension message type */
 #define HS_EX_TYPE_SERVER_NAME 0u
 #define HS_EX_TYPE_MAX_FRAGMENT_LENGTH 1u
@@ -127,6 +127,7 @@ typedef struct {
     uint8_t keModesSize;
     uint8_t supportedVersionsCount; /* Number of supported version */
     uint16_t cookieLen;
+    uint16_t recordSizeLimit; /* record_size_limit advertised by the client */
 
     HITLS_TrustedCAList *caList;
     PreSharedKey *preSharedKey;
@@ -153,6 +154,7 @@ typedef struct {
     bool haveSecRenego;      /* Whether security renegotiation exists. */
     bool haveTicket;         /* Indicates whether a ticket is available. */
     bool haveEncryptThenMac; /* Indicates whether EncryptThenMac is supported. */
+    bool haveRecordSizeLimit; /* Whether the record_size_limit extension exists. */
 } ExtensionFlag;
 
 typedef struct {
@@ -200,6 +202,7 @@ typedef struct {
     uint16_t supportedVersion;
     uint16_t cookieLen;
     uint16_t selectedIdentity; /* TLS 1.3 psk required */
+    uint16_t recordSizeLimit;  /* record_size_limit advertised by the TLS1.2 server */
     uint8_t sessionIdSize;
     uint8_t pointFormatsSize;
     uint8_t secRenegoInfoSize; /* Length of the security renegotiation information */
@@ -215,7 +218,8 @@ typedef struct {
     bool haveSecRenego;
     bool haveTicket;
     bool haveEncryptThenMac;
-    bool reserved[2]; /* Four-byte alignment */
+    bool haveRecordSizeLimit;
+    bool reserved[1]; /* Four-byte alignment */
 } ServerHelloMsg;
 
 /* It is used to transmit hello verify request message */
@@ -340,11 +344,13 @@ typedef struct {
     uint16_t alpnSelectedSize; /* selected alpn protocol length */
     uint8_t *alpnSelected; /* selected alpn protocol */
     uint64_t extensionTypeMask;
+    uint16_t recordSizeLimit; /* record_size_limit advertised by the TLS1.3 server */
 
     bool haveSupportedGroups;
     bool haveEarlyData;
     bool haveServerName;
     bool haveSelectedAlpn;
+    bool haveRecordSizeLimit;
 } EncryptedExtensions;
 
 /* Used to parse the handshake message header. */
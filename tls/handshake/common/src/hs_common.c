@@ -757,11 +757,24 @@ uint32_t HS_GetExtensionTypeId(uint32_t hsExtensionsType)
         case HS_EX_TYPE_POST_HS_AUTH: return HS_EX_TYPE_ID_POST_HS_AUTH;
         case HS_EX_TYPE_KEY_SHARE: return HS_EX_TYPE_ID_KEY_SHARE;
         case HS_EX_TYPE_RENEGOTIATION_INFO: return HS_EX_TYPE_ID_RENEGOTIATION_INFO;
+        case HS_EX_TYPE_RECORD_SIZE_LIMIT: return HS_EX_TYPE_ID_RECORD_SIZE_LIMIT;
         default: break;
     }
     return HS_EX_TYPE_ID_UNRECOGNIZED;
 }
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+uint16_t HS_GetLocalRecordSizeLimit(const TLS_Ctx *ctx, uint16_t version)
+{
+    uint16_t recordSizeLimit = ctx->config.tlsConfig.recordSizeLimit;
+    /* Only TLS1.3 counts the content type in the limit */
+    if (version != HITLS_VERSION_TLS13 && recordSizeLimit > HS_MAX_TLS12_RECORD_SIZE_LIMIT) {
+        recordSizeLimit = HS_MAX_TLS12_RECORD_SIZE_LIMIT;
+    }
+    return recordSizeLimit;
+}
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
+
 int32_t HS_CheckReceivedExtension(HITLS_Ctx *ctx, HS_MsgType hsType, uint64_t hsMsgExtensionsMask,
     uint64_t hsMsgAllowedExtensionsMask)
 {
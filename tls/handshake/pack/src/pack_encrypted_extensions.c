@@ -103,6 +103,11 @@ static int32_t PackEncryptedExs(const TLS_Ctx *ctx, uint8_t *buf, uint32_t bufLe
          .needPack = (ctx->negotiatedInfo.alpnSelected != NULL),
          .packFunc = PackServerSelectAlpnProto},
 #endif /* HITLS_TLS_FEATURE_ALPN */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        {.exMsgType = HS_EX_TYPE_RECORD_SIZE_LIMIT,
+         .needPack = (ctx->negotiatedInfo.pendingRecordSizeLimit != 0),
+         .packFunc = PackRecordSizeLimit},
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
     };
 
     exLen = 0u;
@@ -784,6 +784,24 @@ static bool IsNeedPackPha(const TLS_Ctx *ctx)
 }
 #endif /* HITLS_TLS_FEATURE_PHA */
 #endif /* HITLS_TLS_PROTO_TLS13 */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+int32_t PackRecordSizeLimit(const TLS_Ctx *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *usedLen)
+{
+    /* The client advertises the configured limit, and the server advertises the limit it has negotiated */
+    uint16_t recordSizeLimit = ctx->isClient ?
+        HS_GetLocalRecordSizeLimit(ctx, ctx->config.tlsConfig.maxVersion) : ctx->negotiatedInfo.pendingRecordSizeLimit;
+
+    int32_t ret = PackExtensionHeader(HS_EX_TYPE_RECORD_SIZE_LIMIT, sizeof(uint16_t), buf, bufLen);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+
+    BSL_Uint16ToByte(recordSizeLimit, &buf[HS_EX_HEADER_LEN]);
+    *usedLen = HS_EX_HEADER_LEN + sizeof(uint16_t);
+    return HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
+
 static int32_t PackExtensions(const TLS_Ctx *ctx, uint8_t *buf, uint32_t *bufLen,
     PackExtInfo *extMsgList, uint32_t listSize)
 {
@@ -881,6 +899,9 @@ static int32_t PackClientExtensions(const TLS_Ctx *ctx, uint8_t *buf, uint32_t b
 #ifdef HITLS_TLS_FEATURE_ETM
         { EXTENSION_MSG(HS_EX_TYPE_ENCRYPT_THEN_MAC, tlsConfig->isEncryptThenMac, NULL) },
 #endif /* HITLS_TLS_FEATURE_ETM */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        { EXTENSION_MSG(HS_EX_TYPE_RECORD_SIZE_LIMIT, tlsConfig->recordSizeLimit != 0, PackRecordSizeLimit) },
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
 #ifdef HITLS_TLS_PROTO_TLS13
         { EXTENSION_MSG(HS_EX_TYPE_PRE_SHARED_KEY, IsNeedPreSharedKey(ctx), PackClientPreSharedKey) },
 #endif /* HITLS_TLS_PROTO_TLS13 */
@@ -909,6 +930,9 @@ static int32_t PackClientExtensions(const TLS_Ctx *ctx, uint8_t *buf, uint32_t b
 #ifdef HITLS_TLS_FEATURE_ETM
     ctx->hsCtx->extFlag.haveEncryptThenMac = ctx->config.tlsConfig.isEncryptThenMac;
 #endif /* HITLS_TLS_FEATURE_ETM */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+    ctx->hsCtx->extFlag.haveRecordSizeLimit = (ctx->config.tlsConfig.recordSizeLimit != 0);
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
     return HITLS_SUCCESS;
 }
 
@@ -1259,6 +1283,14 @@ static int32_t PackServerExtensions(const TLS_Ctx *ctx, uint8_t *buf, uint32_t b
 #ifdef HITLS_TLS_FEATURE_ETM
         { EXTENSION_MSG(HS_EX_TYPE_ENCRYPT_THEN_MAC, IsNeedServerPackEncryptThenMac(ctx), NULL) },
 #endif /* HITLS_TLS_FEATURE_ETM */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        /* The TLS1.3 server sends the record_size_limit in the EncryptedExtensions */
+        { EXTENSION_MSG(HS_EX_TYPE_RECORD_SIZE_LIMIT, (negoInfo->pendingRecordSizeLimit != 0
+#ifdef HITLS_TLS_PROTO_TLS13
+            && !isTls13
+#endif
+            ), PackRecordSizeLimit) },
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
 #ifdef HITLS_TLS_PROTO_TLS13
         /* The preshare key must be the last extension */
         { EXTENSION_MSG(HS_EX_TYPE_PRE_SHARED_KEY, IsNeedPreSharedKey(ctx), PackServerPreSharedKey) },
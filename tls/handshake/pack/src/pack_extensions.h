@@ -96,6 +96,19 @@ int32_t PackEmptyExtension(uint16_t exMsgType, bool needPack, uint8_t *buf, uint
 int32_t PackExtensionHeader(uint16_t exMsgType, uint16_t exMsgLen, uint8_t *buf, uint32_t bufLen);
 
 int32_t PackServerSelectAlpnProto(const TLS_Ctx *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *usedLen);
+
+/**
+ * @brief   Pack the record_size_limit extension (RFC 8449)
+ *
+ * @param   ctx [IN] TLS context
+ * @param   buf [OUT] Buffer of the extension
+ * @param   bufLen [IN] Buffer length
+ * @param   usedLen [OUT] Length of the extension
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_PACK_NOT_ENOUGH_BUF_LENGTH The buffer length is insufficient
+ */
+int32_t PackRecordSizeLimit(const TLS_Ctx *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *usedLen);
 #ifdef __cplusplus
 }
 #endif /* end __cplusplus */
@@ -118,6 +118,10 @@ static int32_t ParseEncryptedExBody(TLS_Ctx *ctx, uint16_t extMsgType, const uin
             return ParseServerSelectedAlpnProtocol(
                 &pkt, &msg->haveSelectedAlpn, &msg->alpnSelected, &msg->alpnSelectedSize);
 #endif /* HITLS_TLS_FEATURE_ALPN */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        case HS_EX_TYPE_RECORD_SIZE_LIMIT:
+            return ParseRecordSizeLimit(&pkt, &msg->haveRecordSizeLimit, &msg->recordSizeLimit);
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
         default:
             break;
     }
@@ -53,6 +53,31 @@ int32_t ParseEmptyExtension(TLS_Ctx *ctx, uint16_t extMsgType, uint32_t extMsgLe
     return HITLS_SUCCESS;
 }
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+int32_t ParseRecordSizeLimit(ParsePacket *pkt, bool *haveRecordSizeLimit, uint16_t *recordSizeLimit)
+{
+    /* Parsed extensions of the same type */
+    if (*haveRecordSizeLimit) {
+        return ParseDupExtProcess(pkt->ctx, BINLOG_ID16652, BINGLOG_STR("record size limit"));
+    }
+
+    uint16_t limit = 0;
+    if (pkt->bufLen != sizeof(uint16_t) || ParseBytesToUint16(pkt, &limit) != HITLS_SUCCESS) {
+        return ParseErrorExtLengthProcess(pkt->ctx, BINLOG_ID16653, BINGLOG_STR("record size limit"));
+    }
+
+    /* RFC 8449: Endpoints MUST NOT send a "record_size_limit" extension with a value smaller than 64 */
+    if (limit < HS_MIN_RECORD_SIZE_LIMIT) {
+        return ParseErrorProcess(pkt->ctx, HITLS_PARSE_INVALID_MSG_LEN, BINLOG_ID16655,
+            BINGLOG_STR("record size limit is smaller than 64."), ALERT_ILLEGAL_PARAMETER);
+    }
+
+    *recordSizeLimit = limit;
+    *haveRecordSizeLimit = true;
+    return HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
+
 int32_t ParseExCookie(const uint8_t *buf, uint32_t bufLen, uint8_t **cookie, uint16_t *cookieLen)
 {
     *cookie = NULL; // Initialize the function entry to prevent wild pointers
@@ -225,6 +250,7 @@ bool GetExtensionFlagValue(TLS_Ctx *ctx, uint32_t hsExTypeId)
         case HS_EX_TYPE_ID_SESSION_TICKET:              return ctx->hsCtx->extFlag.haveTicket;
         case HS_EX_TYPE_ID_ENCRYPT_THEN_MAC:            return ctx->hsCtx->extFlag.haveEncryptThenMac;
         case HS_EX_TYPE_ID_SIGNATURE_ALGORITHMS_CERT:   return ctx->hsCtx->extFlag.haveSignatureAlgorithmsCert;
+        case HS_EX_TYPE_ID_RECORD_SIZE_LIMIT:           return ctx->hsCtx->extFlag.haveRecordSizeLimit;
         case HS_EX_TYPE_ID_COOKIE:
         case HS_EX_TYPE_ID_RENEGOTIATION_INFO:
         default:
@@ -103,6 +103,19 @@ void CleanServerHelloExtension(ServerHelloMsg *msg);
  */
 int32_t ParseEmptyExtension(TLS_Ctx *ctx, uint16_t extMsgType, uint32_t extMsgLen, bool *haveExtension);
 
+/**
+ * @brief   Parse the record_size_limit extension (RFC 8449)
+ *
+ * @param   pkt [IN] Context for parsing the extension body
+ * @param   haveRecordSizeLimit [IN/OUT] Whether the extension has been parsed
+ * @param   recordSizeLimit [OUT] Limit advertised by the peer
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_PARSE_INVALID_MSG_LEN The message length is incorrect, or the limit is smaller than 64
+ * @retval  HITLS_PARSE_DUPLICATE_EXTENDED_MSG Extension duplicated
+ */
+int32_t ParseRecordSizeLimit(ParsePacket *pkt, bool *haveRecordSizeLimit, uint16_t *recordSizeLimit);
+
 int32_t ParseExCookie(const uint8_t *buf, uint32_t bufLen, uint8_t **cookie, uint16_t *cookieLen);
 
 int32_t ParseSecRenegoInfo(TLS_Ctx *ctx, const uint8_t *buf, uint32_t bufLen, uint8_t **secRenegoInfo,
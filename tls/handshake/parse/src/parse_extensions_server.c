@@ -760,6 +760,13 @@ static int32_t ParseClientEncryptThenMac(ParsePacket *pkt, ClientHelloMsg *msg)
         &msg->extension.flag.haveEncryptThenMac);
 }
 #endif /* HITLS_TLS_FEATURE_ETM */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+static int32_t ParseClientRecordSizeLimit(ParsePacket *pkt, ClientHelloMsg *msg)
+{
+    return ParseRecordSizeLimit(pkt, &msg->extension.flag.haveRecordSizeLimit,
+        &msg->extension.content.recordSizeLimit);
+}
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
 
 #ifdef HITLS_TLS_FEATURE_SESSION_TICKET
 static int32_t ParseClientTicket(ParsePacket *pkt, ClientHelloMsg *msg)
@@ -825,6 +832,9 @@ static int32_t ParseClientExBody(TLS_Ctx *ctx, uint16_t extMsgType, const uint8_
 #ifdef HITLS_TLS_FEATURE_ETM
         { .exMsgType = HS_EX_TYPE_ENCRYPT_THEN_MAC, .parseFunc = ParseClientEncryptThenMac},
 #endif /* HITLS_TLS_FEATURE_ETM */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        { .exMsgType = HS_EX_TYPE_RECORD_SIZE_LIMIT, .parseFunc = ParseClientRecordSizeLimit},
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
     };
     for (uint32_t index = 0; index < sizeof(extMsgList) / sizeof(extMsgList[0]); index++) {
         if (extMsgList[index].exMsgType == extMsgType) {
@@ -612,6 +612,21 @@ static int32_t ServerDealServerName(TLS_Ctx *ctx, const ClientHelloMsg *clientHe
 }
 #endif /* HITLS_TLS_FEATURE_SNI */
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+static void ServerSelectRecordSizeLimit(TLS_Ctx *ctx, const ClientHelloMsg *clientHello)
+{
+    uint16_t recordSizeLimit = HS_GetLocalRecordSizeLimit(ctx, ctx->negotiatedInfo.version);
+    /* The limits apply only if both ends send the extension, and take effect with the next keys */
+    if (recordSizeLimit == 0 || !clientHello->extension.flag.haveRecordSizeLimit) {
+        ctx->negotiatedInfo.pendingRecordSizeLimit = 0;
+        ctx->negotiatedInfo.pendingPeerRecordSizeLimit = 0;
+        return;
+    }
+    ctx->negotiatedInfo.pendingRecordSizeLimit = recordSizeLimit;
+    ctx->negotiatedInfo.pendingPeerRecordSizeLimit = clientHello->extension.content.recordSizeLimit;
+}
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
+
 static int32_t ProcessClientHelloExt(TLS_Ctx *ctx, const ClientHelloMsg *clientHello, bool isNeedSendHrr)
 {
     (void)ctx;
@@ -634,6 +649,9 @@ static int32_t ProcessClientHelloExt(TLS_Ctx *ctx, const ClientHelloMsg *clientH
         }
     }
 #endif /* HITLS_TLS_FEATURE_ALPN */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+    ServerSelectRecordSizeLimit(ctx, clientHello);
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
     return ret;
 }
 
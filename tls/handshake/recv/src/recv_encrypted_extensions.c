@@ -76,6 +76,24 @@ static int32_t Tls13ClientCheckNegotiatedAlpn(TLS_Ctx *ctx, const EncryptedExten
 }
 #endif
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+static int32_t Tls13ClientCheckRecordSizeLimit(TLS_Ctx *ctx, const EncryptedExtensions *eEMsg)
+{
+    TLS_NegotiatedInfo *negoInfo = &ctx->negotiatedInfo;
+    if (eEMsg->haveRecordSizeLimit) {
+        negoInfo->pendingRecordSizeLimit = HS_GetLocalRecordSizeLimit(ctx, HITLS_VERSION_TLS13);
+        negoInfo->pendingPeerRecordSizeLimit = eEMsg->recordSizeLimit;
+    } else {
+        negoInfo->pendingRecordSizeLimit = 0;
+        negoInfo->pendingPeerRecordSizeLimit = 0;
+    }
+    /* The server applies the limits to the records protected by the handshake keys, which are already in use */
+    negoInfo->recordSizeLimit = negoInfo->pendingRecordSizeLimit;
+    negoInfo->peerRecordSizeLimit = negoInfo->pendingPeerRecordSizeLimit;
+    return HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
+
 static int32_t ClientCheckEncryptedExtensionsFlag(TLS_Ctx *ctx, const EncryptedExtensions *eEMsg)
 {
     static const CheckEncryptedExtFunc EXT_INFO_LIST[] = {
@@ -85,6 +103,9 @@ static int32_t ClientCheckEncryptedExtensionsFlag(TLS_Ctx *ctx, const EncryptedE
 #ifdef HITLS_TLS_FEATURE_ALPN
         Tls13ClientCheckNegotiatedAlpn,
 #endif
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        Tls13ClientCheckRecordSizeLimit,
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
         NULL,
     };
 
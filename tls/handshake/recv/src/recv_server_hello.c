@@ -365,6 +365,26 @@ static int32_t ClientCheckEncryptThenMac(TLS_Ctx *ctx, const ServerHelloMsg *ser
 }
 #endif /* HITLS_TLS_FEATURE_ETM */
 
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+static int32_t ClientCheckRecordSizeLimit(TLS_Ctx *ctx, const ServerHelloMsg *serverHello)
+{
+    /* The TLS1.3 server sends the record_size_limit in the EncryptedExtensions */
+    if (ctx->negotiatedInfo.version == HITLS_VERSION_TLS13) {
+        return HITLS_SUCCESS;
+    }
+    /* The limits take effect with the keys activated by the ChangeCipherSpec */
+    if (serverHello->haveRecordSizeLimit) {
+        ctx->negotiatedInfo.pendingRecordSizeLimit =
+            HS_GetLocalRecordSizeLimit(ctx, ctx->config.tlsConfig.maxVersion);
+        ctx->negotiatedInfo.pendingPeerRecordSizeLimit = serverHello->recordSizeLimit;
+    } else {
+        ctx->negotiatedInfo.pendingRecordSizeLimit = 0;
+        ctx->negotiatedInfo.pendingPeerRecordSizeLimit = 0;
+    }
+    return HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
+
 static int32_t ClientCheckExtensionsFlag(TLS_Ctx *ctx, const ServerHelloMsg *serverHello)
 {
     static const CheckExtFunc extInfoList[] = {
@@ -390,6 +410,9 @@ static int32_t ClientCheckExtensionsFlag(TLS_Ctx *ctx, const ServerHelloMsg *ser
 #ifdef HITLS_TLS_FEATURE_ETM
         ClientCheckEncryptThenMac,
 #endif /* HITLS_TLS_FEATURE_ETM */
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+        ClientCheckRecordSizeLimit,
+#endif /* HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT */
     };
 
     int32_t ret;
@@ -395,6 +395,8 @@ typedef int32_t (*CRYPT_DigestCallback)(HITLS_HashAlgo hashAlgo, const uint8_t *
  * @attention: The protocol allows the sending of app packets with payload length 0.
  *             Therefore, the length of the plaintext input may be 0. Therefore,
  *             the plaintext with the length of 0 must be encrypted.
+ *             For TLS1.3 records, the plaintext is built in the record buffer and encrypted in place,
+ *             that is, in and out may point to the same address.
  * @param   cipher [IN] Key parameters
  * @param   in [IN] Plaintext data
  * @param   inLen [IN] Plaintext data length
@@ -413,6 +415,8 @@ typedef int32_t (*CRYPT_EncryptCallback)(const HITLS_CipherParameters *cipher, c
  * Provides decryption capabilities for records, including the AEAD and CBC algorithms.
  * Decrypt the input factor (key parameter) and ciphertext according to the record protocol to obtain the plaintext.
  *
+ * @attention: An AEAD record that does not fit in the buffer of the reader is decrypted in place in the record buffer,
+ *             that is, in and out may point to the same address.
  * @param   cipher [IN] Key parameters
  * @param   in [IN] Ciphertext data
  * @param   inLen [IN] Ciphertext data length
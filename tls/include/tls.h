@@ -231,6 +231,8 @@ typedef struct {
     uint16_t recordSizeLimit;                      /* read record size limit */
     uint16_t renegoRecordSizeLimit;
     uint16_t peerRecordSizeLimit;                  /* write record size limit */
+    uint16_t pendingRecordSizeLimit;               /* read record size limit taking effect with the next read key */
+    uint16_t pendingPeerRecordSizeLimit;           /* write record size limit taking effect with the next write key */
     bool isResume;                                 /* whether to resume the session */
     bool isRenegotiation;                          /* whether to renegotiate */
 
@@ -503,7 +503,10 @@ enum TLS_BINLOG_ID {
     BINLOG_ID17346, BINLOG_ID17347, BINLOG_ID17348, BINLOG_ID17349, BINLOG_ID17350,
     BINLOG_ID17351, BINLOG_ID17352, BINLOG_ID17353, BINLOG_ID17354, BINLOG_ID17355,
     BINLOG_ID17356, BINLOG_ID17357, BINLOG_ID17358, BINLOG_ID17359, BINLOG_ID17360,
-    BINLOG_ID17361, BINLOG_ID17362, BINLOG_ID17363, BINLOG_ID17364,
+    BINLOG_ID17361, BINLOG_ID17362, BINLOG_ID17363, BINLOG_ID17364, BINLOG_ID17365,
+    BINLOG_ID17366, BINLOG_ID17367, BINLOG_ID17368, BINLOG_ID17369, BINLOG_ID17370,
+    BINLOG_ID17371, BINLOG_ID17372, BINLOG_ID17373, BINLOG_ID17374, BINLOG_ID17375,
+    BINLOG_ID17376, BINLOG_ID17377, BINLOG_ID17378, BINLOG_ID17379, BINLOG_ID17380,
 };
 
 #ifdef HITLS_BSL_LOG
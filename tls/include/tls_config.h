@@ -191,6 +191,7 @@ typedef struct TlsConfig {
 
     uint32_t ticketNums;                /* TLS1.3 ticket number */
     uint16_t maxSendFragment;           /* max send fragment to restrict the amount of plaintext bytes in any record  */
+    uint16_t recordSizeLimit;           /* record_size_limit advertised to the peer, 0: the extension is not sent */
     TLS_SessionMgr *sessMgr;            /* session management */
 
     void *userData;                     /* user data */
@@ -97,6 +97,31 @@ int32_t REC_Init(TLS_Ctx *ctx);
  */
 void REC_DeInit(TLS_Ctx *ctx);
 
+/**
+ * @ingroup record
+ * @brief   Obtain the unread plaintext of the buffered app record without copying it
+ *
+ * @attention The data remains valid until REC_ConsumeAppBuffer drains it or the record layer is called again.
+ * @param   ctx [IN] TLS object
+ * @param   buf [OUT] Start of the unread plaintext, NULL if no app record is buffered
+ * @param   len [OUT] Length of the unread plaintext
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_NULL_INPUT The input parameter is a null pointer.
+ */
+int32_t REC_PeekAppBuffer(const TLS_Ctx *ctx, const uint8_t **buf, uint32_t *len);
+
+/**
+ * @ingroup record
+ * @brief   Mark len bytes of the buffered app record as read
+ *
+ * @param   ctx [IN] TLS object
+ * @param   len [IN] Number of bytes to be consumed
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_NULL_INPUT The input parameter is a null pointer.
+ * @retval  HITLS_INVALID_INPUT len exceeds the unread length of the buffered app record.
+ */
+int32_t REC_ConsumeAppBuffer(TLS_Ctx *ctx, uint32_t len);
+
 /**
  * @ingroup record
  * @brief   Check whether data exists in the read buffer of the reocrd
@@ -154,6 +179,55 @@ int32_t REC_Read(TLS_Ctx *ctx, REC_Type recordType, uint8_t *data, uint32_t *rea
  */
 int32_t REC_Write(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num);
 
+/**
+ * @ingroup record
+ * @brief   Write an app record whose plaintext is gathered from multiple segments
+ *
+ * @attention The segments are gathered into the write buffer and encrypted in place.
+ *            If the value of num exceeds the maximum length of the record, return error
+ *
+ * @param   ctx [IN] TLS object
+ * @param   iov [IN] Segments of the data to be written
+ * @param   iovCnt [IN] Number of the segments
+ * @param   num [IN] Attempt to write num bytes of plaintext data, the segments must hold at least num bytes
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  Other return value refers to REC_Write
+ */
+int32_t REC_Writev(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num);
+
+/**
+ * @ingroup record
+ * @brief   Check whether the app data is written in multiple records, see HITLS_MODE_MULTI_RECORD_WRITE
+ *
+ * @param   ctx [IN] TLS object
+ *
+ * @retval  true The app data longer than a record is split into multiple records
+ * @retval  false The app data is written in a single record
+ */
+bool REC_IsMultiRecordWrite(const TLS_Ctx *ctx);
+
+/**
+ * @ingroup record
+ * @brief   Write app data of any length. The data is split into records which are sent in batches.
+ *
+ * @attention If HITLS_REC_NORMAL_IO_BUSY is returned, the function must be called again with the same data.
+ *
+ * @param   ctx [IN] TLS object
+ * @param   iov [IN] Segments of the data to be written
+ * @param   iovCnt [IN] Number of the segments
+ * @param   num [IN] Attempt to write num bytes of plaintext data, which is the total length of the segments
+ * @param   writeLen [OUT] Length of the data that has been sent
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_NULL_INPUT Invalid null pointer
+ * @retval  HITLS_REC_ERR_IO_EXCEPTION I/O error
+ * @retval  HITLS_REC_NORMAL_IO_BUSY I/O busy
+ * @retval  HITLS_REC_ERR_SN_WRAPPING Sequence number wrap
+ */
+int32_t REC_WriteMultiRecord(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num,
+    uint32_t *writeLen);
+
 /**
  * @ingroup record
  * @brief   Activate the expired write state. This API is invoked in the retransmission scenario
@@ -189,6 +263,39 @@ void REC_DeActiveOutdatedWriteState(TLS_Ctx *ctx);
  */
 int32_t REC_InitPendingState(const TLS_Ctx *ctx, const REC_SecParameters *param);
 
+#ifdef HITLS_TLS_FEATURE_KTLS
+/**
+ * @ingroup record
+ * @brief   Offload the record protection of an established connection to the kernel TLS, see HITLS_MODE_KTLS.
+ *          Each direction whose key the kernel refuses is still processed in user space.
+ *
+ * @param   ctx [IN] TLS object
+ */
+void REC_KtlsEnable(TLS_Ctx *ctx);
+
+/**
+ * @ingroup record
+ * @brief   Check whether the records to be sent are protected by the kernel
+ *
+ * @param   ctx [IN] TLS object
+ *
+ * @retval  true The kernel protects the records to be sent
+ * @retval  false The records to be sent are protected in user space
+ */
+bool REC_IsKtlsSend(const TLS_Ctx *ctx);
+
+/**
+ * @ingroup record
+ * @brief   Check whether the records received are verified by the kernel
+ *
+ * @param   ctx [IN] TLS object
+ *
+ * @retval  true The kernel verifies the records received
+ * @retval  false The records received are verified in user space
+ */
+bool REC_IsKtlsRecv(const TLS_Ctx *ctx);
+#endif
+
 /**
  * @ingroup record
  * @brief    Activate the pending state, switch the pending state to the current state
@@ -225,6 +332,18 @@ int32_t REC_QueryMtu(TLS_Ctx *ctx);
  */
 int32_t REC_GetMaxWriteSize(const TLS_Ctx *ctx, uint32_t *len);
 
+/**
+ * @brief   Obtain the plaintext length of the next app record. It is smaller than the maximum writable length when
+ *          HITLS_MODE_DYNAMIC_RECORD_SIZE is set and the connection has been idle.
+ *
+ * @param   ctx [IN] TLS_Ctx context
+ * @param   len [OUT] Length of the plaintext
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  For details, see REC_GetMaxWriteSize
+ */
+int32_t REC_GetMaxAppWriteSize(const TLS_Ctx *ctx, uint32_t *len);
+
 /**
  * @brief   Obtain the maximum writable plaintext according to mtu
  *
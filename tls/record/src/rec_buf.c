@@ -150,6 +150,39 @@ int32_t RecBufListGetBuffer(RecBufList *bufList, uint8_t *buf, uint32_t bufLen,
     return HITLS_SUCCESS;
 }
 
+int32_t RecBufListPeekBuffer(RecBufList *bufList, uint8_t **buf, uint32_t *len)
+{
+    RecBuf *recBuf = (RecBuf *)BSL_LIST_GET_FIRST(bufList);
+    if (recBuf == NULL || recBuf->buf == NULL) {
+        *buf = NULL;
+        *len = 0;
+        return HITLS_SUCCESS;
+    }
+    *buf = &recBuf->buf[recBuf->start];
+    *len = recBuf->end - recBuf->start;
+    return HITLS_SUCCESS;
+}
+
+int32_t RecBufListConsumeBuffer(RecBufList *bufList, uint32_t len)
+{
+    RecBuf *recBuf = (RecBuf *)BSL_LIST_GET_FIRST(bufList);
+    uint32_t remain = (recBuf == NULL) ? 0 : recBuf->end - recBuf->start;
+    if (len > remain) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17369, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "consume len %u exceeds the buffered len %u", len, remain, 0, 0);
+        BSL_ERR_PUSH_ERROR(HITLS_INVALID_INPUT);
+        return HITLS_INVALID_INPUT;
+    }
+    if (recBuf == NULL) {
+        return HITLS_SUCCESS;
+    }
+    recBuf->start += len;
+    if (recBuf->start == recBuf->end) {
+        BSL_LIST_DeleteCurrent(bufList, (void(*)(void*))RecBufFree);
+    }
+    return HITLS_SUCCESS;
+}
+
 int32_t RecBufListAddBuffer(RecBufList *bufList, RecBuf *buf)
 {
     RecBuf *newBuf = BSL_SAL_Calloc(1U, sizeof(RecBuf));
@@ -69,6 +69,28 @@ bool RecBufListEmpty(RecBufList *bufList);
 
 int32_t RecBufListGetBuffer(RecBufList *bufList, uint8_t *buf, uint32_t bufLen, uint32_t *getLen, bool isPeek);
 
+/**
+ * @brief   Obtain the unread data of the first buffer in the list without copying it
+ *
+ * @param   bufList [IN] Buffer list
+ * @param   buf [OUT] Start of the unread data, NULL if the list is empty
+ * @param   len [OUT] Length of the unread data
+ *
+ * @retval  HITLS_SUCCESS
+ */
+int32_t RecBufListPeekBuffer(RecBufList *bufList, uint8_t **buf, uint32_t *len);
+
+/**
+ * @brief   Mark len bytes of the first buffer in the list as read, the buffer is released when it is drained
+ *
+ * @param   bufList [IN] Buffer list
+ * @param   len [IN] Number of bytes to be consumed
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_INVALID_INPUT len exceeds the unread length of the first buffer
+ */
+int32_t RecBufListConsumeBuffer(RecBufList *bufList, uint32_t len);
+
 int32_t RecBufListAddBuffer(RecBufList *bufList, RecBuf *buf);
 
 int32_t RecBufResize(RecBuf *recBuf, uint32_t size);
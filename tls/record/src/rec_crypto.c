@@ -94,14 +94,13 @@ static int32_t DefaultDecryptPostProcess(TLS_Ctx *ctx, RecConnSuitInfo *suiteInf
 #endif
     return HITLS_SUCCESS;
 }
-static int32_t DefaultEncryptPreProcess(TLS_Ctx *ctx, uint8_t recordType, const uint8_t *data, uint32_t plainLen,
+static int32_t DefaultEncryptPreProcess(TLS_Ctx *ctx, uint8_t recordType, uint32_t plainLen,
     RecordPlaintext *recPlaintext)
 {
 #ifdef HITLS_TLS_PROTO_TLS
-    (void)ctx, (void)data;
+    (void)ctx;
     recPlaintext->recordType = recordType;
     recPlaintext->plainLen = plainLen;
-    recPlaintext->plainData = NULL;
 #ifdef HITLS_TLS_PROTO_TLS13
     if (ctx->negotiatedInfo.version != HITLS_VERSION_TLS13 ||
         ctx->recCtx->writeStates.currentState->suiteInfo == NULL) {
@@ -131,34 +130,43 @@ static int32_t DefaultEncryptPreProcess(TLS_Ctx *ctx, uint8_t recordType, const
         return HITLS_REC_RECORD_OVERFLOW;
     }
 
-    uint8_t *tlsInnerPlaintext = BSL_SAL_Calloc(1u, tlsInnerPlaintextLen);
-    if (tlsInnerPlaintext == NULL) {
-        BSL_ERR_PUSH_ERROR(HITLS_MEMALLOC_FAIL);
-        return RETURN_ERROR_NUMBER_PROCESS(HITLS_MEMALLOC_FAIL, BINLOG_ID17253, "Calloc fail");
-    }
-
-    if (memcpy_s(tlsInnerPlaintext, tlsInnerPlaintextLen, data, plainLen) != EOK) {
-        BSL_SAL_FREE(tlsInnerPlaintext);
-        BSL_ERR_PUSH_ERROR(HITLS_MEMCPY_FAIL);
-        return RETURN_ERROR_NUMBER_PROCESS(HITLS_MEMCPY_FAIL, BINLOG_ID17254, "memcpy fail");
-    }
-
-    tlsInnerPlaintext[plainLen] = recordType;
-
-    /* Padding is calloc when the memory is applied for. Therefore, the number of buffs to be supplemented is 0. You do
-     * not need to perform any operation */
+    /* The TLSInnerPlaintext is packed by the caller in the record buffer, see RecPackInnerPlaintext */
     recPlaintext->plainLen = tlsInnerPlaintextLen;
-    recPlaintext->plainData = tlsInnerPlaintext;
+    recPlaintext->recPaddingLength = recPaddingLength;
     /* tls1.3 Hide the actual record type during encryption */
     recPlaintext->recordType = (uint8_t)REC_TYPE_APP;
 #endif /* HITLS_TLS_PROTO_TLS13 */
     return HITLS_SUCCESS;
 #else
-    (void)ctx, (void)recordType, (void)data, (void)plainLen, (void)recPlaintext;
+    (void)ctx, (void)recordType, (void)plainLen, (void)recPlaintext;
     return HITLS_REC_ERR_NOT_SUPPORT_CIPHER;
 #endif /* HITLS_TLS_PROTO_TLS */
 }
 
+#if defined(HITLS_TLS_PROTO_TLS) && defined(HITLS_TLS_PROTO_TLS13)
+int32_t RecPackInnerPlaintext(const RecordPlaintext *recPlaintext, uint8_t contentType, const uint8_t *data,
+    uint32_t dataLen, uint8_t *out, uint32_t outLen)
+{
+    if (recPlaintext->plainLen > outLen || recPlaintext->plainLen != dataLen + 1 + recPlaintext->recPaddingLength) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_BUFFER_NOT_ENOUGH);
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17253, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Pack TlsInnerPlaintext: buffer is not enough, need %u, have %u.", recPlaintext->plainLen, outLen, 0, 0);
+        return HITLS_REC_ERR_BUFFER_NOT_ENOUGH;
+    }
+
+    /* content, which may have been gathered in place already */
+    if (dataLen > 0 && data != out && memcpy_s(out, outLen, data, dataLen) != EOK) {
+        BSL_ERR_PUSH_ERROR(HITLS_MEMCPY_FAIL);
+        return RETURN_ERROR_NUMBER_PROCESS(HITLS_MEMCPY_FAIL, BINLOG_ID17254, "memcpy fail");
+    }
+    /* ContentType type */
+    out[dataLen] = contentType;
+    /* uint8 zeros[length_of_padding] */
+    (void)memset_s(&out[dataLen + 1], outLen - dataLen - 1, 0, (uint32_t)recPlaintext->recPaddingLength);
+    return HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_PROTO_TLS && HITLS_TLS_PROTO_TLS13 */
+
 static uint32_t PlainCalCiphertextLen(const TLS_Ctx *ctx, RecConnSuitInfo *suiteInfo, uint32_t plantextLen, bool isRead)
 {
     (void)ctx;
@@ -195,7 +203,8 @@ static int32_t PlainEncrypt(TLS_Ctx *ctx, RecConnState *state, const REC_TextInp
 {
     (void)ctx;
     (void)state;
-    if (memcpy_s(cipherText, cipherTextLen, plainMsg->text, plainMsg->textLen) != EOK) {
+    if (plainMsg->text != cipherText &&
+        memcpy_s(cipherText, cipherTextLen, plainMsg->text, plainMsg->textLen) != EOK) {
         BSL_ERR_PUSH_ERROR(HITLS_MEMCPY_FAIL);
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15926, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "Record:memcpy fail.", 0, 0, 0, 0);
@@ -235,7 +244,8 @@ const RecCryptoFunc *RecGetCryptoFuncs(const RecConnSuitInfo *suiteInfo)
         PlainDecrypt,
         DefaultDecryptPostProcess,
         PlainEncrypt,
-        DefaultEncryptPreProcess
+        DefaultEncryptPreProcess,
+        NULL
     };
     if (suiteInfo == NULL) {
         return &cryptoFuncPlain;
@@ -261,7 +271,8 @@ const RecCryptoFunc *RecGetCryptoFuncs(const RecConnSuitInfo *suiteInfo)
         UnsupoortDecrypt,
         DefaultDecryptPostProcess,
         UnsupoortEncrypt,
-        DefaultEncryptPreProcess
+        DefaultEncryptPreProcess,
+        NULL
     };
     return &cryptoFuncUnsupport;
 }
@@ -23,9 +23,8 @@
 typedef struct {
     REC_Type recordType; /* Protocol type */
     uint32_t plainLen;   /* message length */
-    uint8_t *plainData;  /* message data */
 #ifdef HITLS_TLS_PROTO_TLS13
-    /* Length of the tls1.3 padding content. Currently, the value is 0. The value can be used as required */
+    /* Length of the tls1.3 padding content, obtained from the record padding callback */
     uint64_t recPaddingLength;
 #endif
     bool isTlsInnerPlaintext; /* Whether it is a TLSInnerPlaintext message for tls1.3 */
@@ -34,6 +33,12 @@ typedef struct {
 typedef struct DtlsRecordPlaintext RecordPlaintext;
 #endif
 
+typedef struct {
+    REC_TextInput plainMsg; /* Record to be encrypted */
+    uint8_t *cipherText;    /* Record body in the write buffer */
+    uint32_t cipherTextLen; /* Length of the record body after encryption */
+} RecBatchRecord;           /* One of the records encrypted by one call */
+
 typedef uint32_t (*CalCiphertextLenFunc)(const TLS_Ctx *ctx, RecConnSuitInfo *suitInfo,
     uint32_t plantextLen, bool isRead);
 typedef int32_t (*CalPlantextBufLenFunc)(TLS_Ctx *ctx, RecConnSuitInfo *suitInfo,
@@ -42,9 +47,11 @@ typedef int32_t (*DecryptFunc)(TLS_Ctx *ctx, RecConnState *state, const REC_Text
     uint8_t *data, uint32_t *dataLen);
 typedef int32_t (*EncryptFunc)(TLS_Ctx *ctx, RecConnState *state, const REC_TextInput *plainMsg,
     uint8_t *cipherText, uint32_t cipherTextLen);
+typedef int32_t (*EncryptBatchFunc)(TLS_Ctx *ctx, RecConnState *state, const RecBatchRecord *records,
+    uint32_t num);
 typedef int32_t (*DecryptPostProcess)(TLS_Ctx *ctx, RecConnSuitInfo *suitInfo, REC_TextInput *cryptMsg,
     uint8_t *data, uint32_t *dataLen);
-typedef int32_t (*EncryptPreProcess)(TLS_Ctx *ctx, uint8_t recordType, const uint8_t *data, uint32_t plainLen,
+typedef int32_t (*EncryptPreProcess)(TLS_Ctx *ctx, uint8_t recordType, uint32_t plainLen,
     RecordPlaintext *recPlaintext);
 
 typedef struct {
@@ -54,7 +61,27 @@ typedef struct {
     DecryptPostProcess decryptPostProcess;
     EncryptFunc encryt;
     EncryptPreProcess encryptPreProcess;
+    EncryptBatchFunc encryptBatch; /* NULL if the records can only be encrypted one by one */
 } RecCryptoFunc;
 
 const RecCryptoFunc *RecGetCryptoFuncs(const RecConnSuitInfo *suiteInfo);
+
+#if defined(HITLS_TLS_PROTO_TLS) && defined(HITLS_TLS_PROTO_TLS13)
+/**
+ * @brief   Build the TLSInnerPlaintext in place in the record buffer, the buffer is then encrypted in place.
+ *
+ * @param   recPlaintext [IN] Record plaintext information generated by encryptPreProcess
+ * @param   contentType [IN] Actual record type, which is hidden in the TLSInnerPlaintext
+ * @param   data [IN] Record content, which may already be located at out
+ * @param   dataLen [IN] Length of the record content
+ * @param   out [OUT] Start address of the record body in the record buffer
+ * @param   outLen [IN] Length of the space available for the record body
+ *
+ * @retval  HITLS_SUCCESS succeeded
+ * @retval  HITLS_REC_ERR_BUFFER_NOT_ENOUGH The record buffer is not enough
+ * @retval  HITLS_MEMCPY_FAIL Memory copy failed
+ */
+int32_t RecPackInnerPlaintext(const RecordPlaintext *recPlaintext, uint8_t contentType, const uint8_t *data,
+    uint32_t dataLen, uint8_t *out, uint32_t outLen);
+#endif
 #endif
\ No newline at end of file
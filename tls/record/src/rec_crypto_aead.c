@@ -227,33 +227,14 @@ static int32_t AeadDecrypt(TLS_Ctx *ctx, RecConnState *state, const REC_TextInpu
     return HITLS_SUCCESS;
 }
 
-/**
- * @brief AEAD encryption
- *
- * @param state [IN] RecConnState Context
- * @param input [IN] Input data before encryption
- * @param cipherText [OUT] Encrypted content
- * @param cipherTextLen [IN] Length after encryption
- *
- * @retval HITLS_SUCCESS succeeded.
- * @retval HITLS_INTERNAL_EXCEPTION: null pointer
- * @retval HITLS_MEMCPY_FAIL The copy fails.
- * @retval For details, see SAL_CRYPT_Encrypt.
- */
-static int32_t AeadEncrypt(TLS_Ctx *ctx, RecConnState *state, const REC_TextInput *plainMsg, uint8_t *cipherText,
-    uint32_t cipherTextLen)
+/* Write the explicit IV and calculate the nonce and additional_data of the record to be encrypted */
+static int32_t AeadEncryptPrepare(const RecConnSuitInfo *suiteInfo, const REC_TextInput *plainMsg,
+    uint8_t *cipherText, uint32_t cipherTextLen, HITLS_AeadRecord *record)
 {
     /** Initialize the encryption length offset */
     uint32_t cipherOffset = 0u;
-    HITLS_CipherParameters cipherParam = {0};
-    cipherParam.ctx = &state->suiteInfo->ctx;
-    cipherParam.type = state->suiteInfo->cipherType;
-    cipherParam.algo = state->suiteInfo->cipherAlg;
-    cipherParam.key = (const uint8_t *)state->suiteInfo->key;
-    cipherParam.keyLen = state->suiteInfo->encKeyLen;
-
     /** During AEAD encryption, the sequence number is used as the explicit IV */
-    if (state->suiteInfo->recordIvLength > 0u) {
+    if (suiteInfo->recordIvLength > 0u) {
         if (memcpy_s(&cipherText[cipherOffset], cipherTextLen, plainMsg->seq, REC_CONN_SEQ_SIZE) != EOK) {
             BSL_ERR_PUSH_ERROR(HITLS_MEMCPY_FAIL);
             BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15384, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
@@ -264,36 +245,126 @@ static int32_t AeadEncrypt(TLS_Ctx *ctx, RecConnState *state, const REC_TextInpu
     }
 
     /** Calculate NONCE */
-    uint8_t nonce[AEAD_NONCE_SIZE] = {0};
-    int32_t ret = AeadGetNonce(state->suiteInfo, nonce, sizeof(nonce), plainMsg->seq, REC_CONN_SEQ_SIZE);
+    int32_t ret = AeadGetNonce(suiteInfo, (uint8_t *)(uintptr_t)record->iv, AEAD_NONCE_SIZE, plainMsg->seq,
+        REC_CONN_SEQ_SIZE);
     if (ret != HITLS_SUCCESS) {
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15385, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "Record encrypt:get nonce failed.", 0, 0, 0, 0);
         return ret;
     }
-    cipherParam.iv = nonce;
-    cipherParam.ivLen = AEAD_NONCE_SIZE;
+    record->ivLen = AEAD_NONCE_SIZE;
 
     /* Calculate additional_data */
-    uint8_t aad[AEAD_AAD_MAX_SIZE];
-    uint32_t aadLen = AEAD_AAD_MAX_SIZE;
     uint32_t textLen =
 #ifdef HITLS_TLS_PROTO_TLS13
         (plainMsg->negotiatedVersion == HITLS_VERSION_TLS13) ? cipherTextLen :
 #endif /* HITLS_TLS_PROTO_TLS13 */
         plainMsg->textLen;
-    AeadGetAad(aad, &aadLen, plainMsg, textLen);
-    cipherParam.aad = aad;
-    cipherParam.aadLen = aadLen;
+    AeadGetAad((uint8_t *)(uintptr_t)record->aad, &record->aadLen, plainMsg, textLen);
 
+    record->in = plainMsg->text;
+    record->inLen = plainMsg->textLen;
+    record->out = &cipherText[cipherOffset];
     /** Calculate the encryption length */
-    uint32_t cipherLen = cipherTextLen - cipherOffset;
-    uint32_t outLen = cipherLen;
+    record->outLen = cipherTextLen - cipherOffset;
+    return HITLS_SUCCESS;
+}
+
+static void AeadInitCipherParam(RecConnSuitInfo *suiteInfo, HITLS_CipherParameters *cipherParam)
+{
+    cipherParam->ctx = &suiteInfo->ctx;
+    cipherParam->type = suiteInfo->cipherType;
+    cipherParam->algo = suiteInfo->cipherAlg;
+    cipherParam->key = (const uint8_t *)suiteInfo->key;
+    cipherParam->keyLen = suiteInfo->encKeyLen;
+}
+
+/**
+ * @brief AEAD encryption
+ *
+ * @param state [IN] RecConnState Context
+ * @param input [IN] Input data before encryption
+ * @param cipherText [OUT] Encrypted content
+ * @param cipherTextLen [IN] Length after encryption
+ *
+ * @retval HITLS_SUCCESS succeeded.
+ * @retval HITLS_INTERNAL_EXCEPTION: null pointer
+ * @retval HITLS_MEMCPY_FAIL The copy fails.
+ * @retval For details, see SAL_CRYPT_Encrypt.
+ */
+static int32_t AeadEncrypt(TLS_Ctx *ctx, RecConnState *state, const REC_TextInput *plainMsg, uint8_t *cipherText,
+    uint32_t cipherTextLen)
+{
+    HITLS_CipherParameters cipherParam = {0};
+    AeadInitCipherParam(state->suiteInfo, &cipherParam);
+
+    uint8_t nonce[AEAD_NONCE_SIZE] = {0};
+    uint8_t aad[AEAD_AAD_MAX_SIZE];
+    HITLS_AeadRecord record = {0};
+    record.iv = nonce;
+    record.aad = aad;
+    int32_t ret = AeadEncryptPrepare(state->suiteInfo, plainMsg, cipherText, cipherTextLen, &record);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    cipherParam.iv = nonce;
+    cipherParam.ivLen = record.ivLen;
+    cipherParam.aad = aad;
+    cipherParam.aadLen = record.aadLen;
+
+    uint32_t cipherLen = record.outLen;
     /** Encryption */
     ret = SAL_CRYPT_Encrypt(LIBCTX_FROM_CTX(ctx), ATTRIBUTE_FROM_CTX(ctx),
-        &cipherParam, plainMsg->text, plainMsg->textLen, &cipherText[cipherOffset], &outLen);
+        &cipherParam, record.in, record.inLen, record.out, &record.outLen);
+    /* Clear sensitive information */
+    return CleanSensitiveData(ret, nonce, aad, record.outLen, cipherLen);
+}
+
+/* Encrypt the records packed back-to-back in the write buffer by one call to the crypto layer, which seals them
+ * with the same cipher handle */
+static int32_t AeadEncryptBatch(TLS_Ctx *ctx, RecConnState *state, const RecBatchRecord *records, uint32_t num)
+{
+    if (num > REC_MAX_WRITE_BATCH_RECORD_NUM) {
+        BSL_ERR_PUSH_ERROR(HITLS_INTERNAL_EXCEPTION);
+        return HITLS_INTERNAL_EXCEPTION;
+    }
+    HITLS_CipherParameters cipherParam = {0};
+    AeadInitCipherParam(state->suiteInfo, &cipherParam);
+
+    uint8_t nonce[REC_MAX_WRITE_BATCH_RECORD_NUM][AEAD_NONCE_SIZE];
+    uint8_t aad[REC_MAX_WRITE_BATCH_RECORD_NUM][AEAD_AAD_MAX_SIZE];
+    HITLS_AeadRecord aeadRecords[REC_MAX_WRITE_BATCH_RECORD_NUM] = {0};
+    int32_t ret = HITLS_SUCCESS;
+    for (uint32_t i = 0; i < num && ret == HITLS_SUCCESS; i++) {
+        aeadRecords[i].iv = nonce[i];
+        aeadRecords[i].aad = aad[i];
+        ret = AeadEncryptPrepare(state->suiteInfo, &records[i].plainMsg, records[i].cipherText,
+            records[i].cipherTextLen, &aeadRecords[i]);
+    }
+    uint32_t cipherLen[REC_MAX_WRITE_BATCH_RECORD_NUM];
+    for (uint32_t i = 0; i < num && ret == HITLS_SUCCESS; i++) {
+        cipherLen[i] = aeadRecords[i].outLen;
+    }
+    if (ret == HITLS_SUCCESS) {
+        ret = SAL_CRYPT_EncryptBatch(LIBCTX_FROM_CTX(ctx), ATTRIBUTE_FROM_CTX(ctx), &cipherParam, aeadRecords, num);
+    }
     /* Clear sensitive information */
-    return CleanSensitiveData(ret, nonce, aad, outLen, cipherLen);
+    for (uint32_t i = 0; i < num; i++) {
+        BSL_SAL_CleanseData(nonce[i], AEAD_NONCE_SIZE);
+        BSL_SAL_CleanseData(aad[i], AEAD_AAD_MAX_SIZE);
+    }
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        if (aeadRecords[i].outLen != cipherLen[i]) {
+            BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_ENCRYPT);
+            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15481, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                "Record:encrypt error. outLen:%u cipherLen:%u", aeadRecords[i].outLen, cipherLen[i], NULL, NULL);
+            return HITLS_REC_ERR_ENCRYPT;
+        }
+    }
+    return HITLS_SUCCESS;
 }
 
 const RecCryptoFunc *RecGetAeadCryptoFuncs(DecryptPostProcess decryptPostProcess, EncryptPreProcess encryptPreProcess)
@@ -303,6 +374,7 @@ const RecCryptoFunc *RecGetAeadCryptoFuncs(DecryptPostProcess decryptPostProcess
         .calPlantextBufLen = AeadCalPlantextBufLen,
         .decrypt = AeadDecrypt,
         .encryt = AeadEncrypt,
+        .encryptBatch = AeadEncryptBatch,
     };
     cryptoFuncAead.decryptPostProcess = decryptPostProcess;
     cryptoFuncAead.encryptPreProcess = encryptPreProcess;
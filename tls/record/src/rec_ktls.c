@@ -0,0 +1,297 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+#include "hitls_build.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include "securec.h"
+#include "tls_binlog_id.h"
+#include "bsl_log_internal.h"
+#include "bsl_log.h"
+#include "bsl_err_internal.h"
+#include "bsl_errno.h"
+#include "bsl_uio.h"
+#include "hitls_error.h"
+#include "hitls_type.h"
+#include "tls.h"
+#include "record.h"
+#include "rec_conn.h"
+#include "rec_write.h"
+#include "rec_read.h"
+#include "rec_ktls.h"
+
+static BSL_UIO *KtlsGetUio(const TLS_Ctx *ctx, bool isOut)
+{
+#ifdef HITLS_TLS_FEATURE_FLIGHT
+    if (!isOut) {
+        return ctx->rUio;
+    }
+#else
+    (void)isOut;
+#endif
+    return ctx->uio;
+}
+
+static bool KtlsGetCipher(HITLS_CipherAlgo cipherAlg, BSL_UIO_KtlsCipher *cipher)
+{
+    switch (cipherAlg) {
+        case HITLS_CIPHER_AES_128_GCM:
+            *cipher = BSL_UIO_KTLS_AES_128_GCM;
+            return true;
+        case HITLS_CIPHER_AES_256_GCM:
+            *cipher = BSL_UIO_KTLS_AES_256_GCM;
+            return true;
+        case HITLS_CIPHER_CHACHA20_POLY1305:
+            *cipher = BSL_UIO_KTLS_CHACHA20_POLY1305;
+            return true;
+        case HITLS_CIPHER_SM4_GCM:
+            *cipher = BSL_UIO_KTLS_SM4_GCM;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* Hand the key and the sequence number of the current state over to the socket */
+static int32_t KtlsSetKey(TLS_Ctx *ctx, bool isOut)
+{
+    RecCtx *recCtx = ctx->recCtx;
+    RecConnState *state = isOut ? recCtx->writeStates.currentState : recCtx->readStates.currentState;
+    RecConnSuitInfo *suiteInfo = state->suiteInfo;
+    BSL_UIO_KtlsCryptoInfo info = {0};
+    if (suiteInfo == NULL || suiteInfo->cipherType != HITLS_AEAD_CIPHER ||
+        !KtlsGetCipher(suiteInfo->cipherAlg, &info.cipher)) {
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    info.isSend = isOut;
+    info.version = ctx->negotiatedInfo.version;
+    info.key = suiteInfo->key;
+    info.keyLen = suiteInfo->encKeyLen;
+    info.iv = suiteInfo->iv;
+    info.ivLen = suiteInfo->fixedIvLength;
+    info.seq = RecConnGetSeqNum(state);
+    if (BSL_UIO_Ctrl(KtlsGetUio(ctx, isOut), BSL_UIO_TCP_SET_KTLS, (int32_t)sizeof(info), &info) != BSL_SUCCESS) {
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    return HITLS_SUCCESS;
+}
+
+static bool KtlsIsSupported(const TLS_Ctx *ctx)
+{
+    if ((ctx->config.tlsConfig.modeSupport & HITLS_MODE_KTLS) == 0 ||
+        IS_SUPPORT_DATAGRAM(ctx->config.tlsConfig.originVersionMask)) {
+        return false;
+    }
+    uint16_t version = ctx->negotiatedInfo.version;
+    if (version == HITLS_VERSION_TLS12) {
+        /* The kernel cannot change the key of a TLS 1.2 connection, which renegotiation would need */
+        return !ctx->config.tlsConfig.isSupportRenegotiation;
+    }
+    return version == HITLS_VERSION_TLS13;
+}
+
+static void KtlsEnableSend(TLS_Ctx *ctx)
+{
+    RecCtx *recCtx = ctx->recCtx;
+    uint32_t maxWriteSize = 0;
+    /* The kernel splits the data into records of the maximum length, and neither pads nor shortens them */
+    if (REC_GetMaxWriteSize(ctx, &maxWriteSize) != HITLS_SUCCESS || maxWriteSize != REC_MAX_PLAIN_LENGTH ||
+        ctx->config.tlsConfig.recordPaddingCb != NULL || recCtx->outBuf->end != recCtx->outBuf->start) {
+        return;
+    }
+    /* The records protected in user space must reach the socket before the kernel takes over */
+    if (BSL_UIO_Ctrl(ctx->uio, BSL_UIO_FLUSH, 0, NULL) != BSL_SUCCESS) {
+        return;
+    }
+    if (KtlsSetKey(ctx, true) != HITLS_SUCCESS) {
+        return;
+    }
+    recCtx->isKtlsSend = true;
+    recCtx->ktlsSendType = REC_TYPE_APP;
+    BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17371, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+        "Record: the records to be sent are protected by the kernel.", 0, 0, 0, 0);
+}
+
+void RecKtlsTryEnableRecv(TLS_Ctx *ctx)
+{
+    RecCtx *recCtx = ctx->recCtx;
+    /* Records already read from the socket are processed in user space first */
+    if (!recCtx->isKtlsRecvPending || recCtx->inBuf->end != recCtx->inBuf->start) {
+        return;
+    }
+    recCtx->isKtlsRecvPending = false;
+    if (KtlsSetKey(ctx, false) != HITLS_SUCCESS) {
+        return;
+    }
+    recCtx->isKtlsRecv = true;
+    BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17372, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+        "Record: the records received are verified by the kernel.", 0, 0, 0, 0);
+}
+
+void REC_KtlsEnable(TLS_Ctx *ctx)
+{
+    if (ctx == NULL || ctx->recCtx == NULL || !KtlsIsSupported(ctx)) {
+        return;
+    }
+    RecCtx *recCtx = ctx->recCtx;
+    if (!recCtx->isKtlsSend) {
+        KtlsEnableSend(ctx);
+    }
+    if (!recCtx->isKtlsRecv) {
+        recCtx->isKtlsRecvPending = true;
+        RecKtlsTryEnableRecv(ctx);
+    }
+}
+
+bool REC_IsKtlsSend(const TLS_Ctx *ctx)
+{
+    return ctx != NULL && ctx->recCtx != NULL && ctx->recCtx->isKtlsSend;
+}
+
+bool REC_IsKtlsRecv(const TLS_Ctx *ctx)
+{
+    return ctx != NULL && ctx->recCtx != NULL && ctx->recCtx->isKtlsRecv;
+}
+
+int32_t RecKtlsUpdateKey(TLS_Ctx *ctx, bool isOut)
+{
+    RecCtx *recCtx = ctx->recCtx;
+    if (!isOut && recCtx->isKtlsRecvPending) {
+        /* The old key is still used in user space, the new one is handed over once the read buffer is drained */
+        return HITLS_SUCCESS;
+    }
+    if (!(isOut ? recCtx->isKtlsSend : recCtx->isKtlsRecv)) {
+        return HITLS_SUCCESS;
+    }
+    /* The data protected by the old key must be sent before the kernel switches the key */
+    if (isOut && BSL_UIO_Ctrl(ctx->uio, BSL_UIO_FLUSH, 0, NULL) != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_IO_EXCEPTION);
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17373, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record: fail to flush the data before the kernel key update.", 0, 0, 0, 0);
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    int32_t ret = KtlsSetKey(ctx, isOut);
+    if (ret != HITLS_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(ret);
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17374, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record: the kernel refuses the new key, isOut = %u.", isOut, 0, 0, 0);
+        return ret;
+    }
+    return HITLS_SUCCESS;
+}
+
+static int32_t KtlsSetRecordType(TLS_Ctx *ctx, REC_Type recordType)
+{
+    RecCtx *recCtx = ctx->recCtx;
+    if (recCtx->ktlsSendType == (uint8_t)recordType) {
+        return HITLS_SUCCESS;
+    }
+    /* The data buffered by the UIO belongs to records of the previous type */
+    int32_t ret = BSL_UIO_Ctrl(ctx->uio, BSL_UIO_FLUSH, 0, NULL);
+    if (ret == BSL_UIO_IO_BUSY) {
+        return HITLS_REC_NORMAL_IO_BUSY;
+    }
+    uint8_t type = (uint8_t)recordType;
+    if (ret != BSL_SUCCESS ||
+        BSL_UIO_Ctrl(ctx->uio, BSL_UIO_TCP_SET_KTLS_RECORD_TYPE, (int32_t)sizeof(type), &type) != BSL_SUCCESS) {
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_IO_EXCEPTION);
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17375, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record: fail to set the kernel record type %u.", recordType, 0, 0, 0);
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+    recCtx->ktlsSendType = type;
+    return HITLS_SUCCESS;
+}
+
+int32_t RecKtlsWrite(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num)
+{
+    RecBuf *writeBuf = ctx->recCtx->outBuf;
+    /* The rest of the data of the last call is cached */
+    if (writeBuf->end > writeBuf->start) {
+        return StreamWrite(ctx, writeBuf);
+    }
+    int32_t ret = KtlsSetRecordType(ctx, recordType);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_WRITING;
+#endif
+    uint32_t offset = 0;
+    while (offset < num) {
+        uint32_t sendLen = 0u;
+        ret = BSL_UIO_Write(ctx->uio, &data[offset], num - offset, &sendLen);
+        if (ret != BSL_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_IO_EXCEPTION);
+            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17376, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                "Record send: kernel tls IO exception. %d\n", ret, 0, 0, 0);
+            return HITLS_REC_ERR_IO_EXCEPTION;
+        }
+        if (sendLen == 0) {
+            /* Cache the rest, so that the data is not sent twice when the call is repeated */
+            (void)memmove_s(writeBuf->buf, writeBuf->bufSize, &data[offset], num - offset);
+            writeBuf->start = 0;
+            writeBuf->end = num - offset;
+            return HITLS_REC_NORMAL_IO_BUSY;
+        }
+        offset += sendLen;
+    }
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_NOTHING;
+#endif
+    return HITLS_SUCCESS;
+}
+
+int32_t RecKtlsWriteMulti(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num, uint32_t *writeLen)
+{
+    RecCtx *recCtx = ctx->recCtx;
+    RecBuf *writeBuf = recCtx->outBuf;
+    int32_t ret = KtlsSetRecordType(ctx, REC_TYPE_APP);
+    if (ret != HITLS_SUCCESS) {
+        *writeLen = recCtx->pendingDataSent;
+        return ret;
+    }
+    /* The kernel splits the data into records, so the data is written in as few I/O writes as possible. The progress
+     * is kept in pendingDataSent, and the data is passed again when the call is repeated. */
+    while (recCtx->pendingDataSent < num) {
+        const uint8_t *data = (const uint8_t *)iov[0].base + recCtx->pendingDataSent;
+        uint32_t len = num - recCtx->pendingDataSent;
+        if (iovCnt > 1) {
+            len = (len > writeBuf->bufSize) ? writeBuf->bufSize : len;
+            RecGatherData(iov, iovCnt, recCtx->pendingDataSent, writeBuf->buf, len);
+            data = writeBuf->buf;
+        }
+        uint32_t sendLen = 0u;
+        ret = BSL_UIO_Write(ctx->uio, data, len, &sendLen);
+        if (ret != BSL_SUCCESS) {
+            BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_IO_EXCEPTION);
+            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17377, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                "Record send: kernel tls IO exception. %d\n", ret, 0, 0, 0);
+            *writeLen = recCtx->pendingDataSent;
+            return HITLS_REC_ERR_IO_EXCEPTION;
+        }
+        if (sendLen == 0) {
+#ifdef HITLS_TLS_CONFIG_STATE
+            ctx->rwstate = HITLS_WRITING;
+#endif
+            *writeLen = recCtx->pendingDataSent;
+            return HITLS_REC_NORMAL_IO_BUSY;
+        }
+        recCtx->pendingDataSent += sendLen;
+    }
+    *writeLen = num;
+    recCtx->pendingDataPacked = 0;
+    recCtx->pendingDataSent = 0;
+    return HITLS_SUCCESS;
+}
+#endif /* HITLS_TLS_FEATURE_KTLS */
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the openHiTLS project.
+ *
+ * openHiTLS is licensed under the Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *     http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ */
+
+#ifndef REC_KTLS_H
+#define REC_KTLS_H
+
+#include "hitls_build.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include <stdint.h>
+#include <stdbool.h>
+#include "tls.h"
+#include "rec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Offload the protection of the records received to the kernel if it is pending and the read buffer holds
+ *          no unprocessed record. If the kernel refuses the key, the records are still processed in user space.
+ *
+ * @param   ctx [IN] TLS context
+ */
+void RecKtlsTryEnableRecv(TLS_Ctx *ctx);
+
+/**
+ * @brief   Hand the current key of an offloaded direction over to the kernel after the key is changed.
+ *
+ * @param   ctx [IN] TLS context
+ * @param   isOut [IN] true: the key of the records to be sent, false: the key of the records received
+ *
+ * @retval  HITLS_SUCCESS The direction is not offloaded, or the kernel accepts the new key
+ * @retval  HITLS_REC_ERR_IO_EXCEPTION The kernel refuses the new key, the connection cannot continue
+ */
+int32_t RecKtlsUpdateKey(TLS_Ctx *ctx, bool isOut);
+
+/**
+ * @brief   Write data in kTLS mode. The kernel builds and protects the records of the type set by the
+ *          BSL_UIO_TCP_SET_KTLS_RECORD_TYPE command.
+ *
+ * @param   ctx [IN] TLS context
+ * @param   recordType [IN] Record type
+ * @param   data [IN] Data to be written
+ * @param   num [IN] Data length
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_REC_ERR_IO_EXCEPTION I/O error
+ * @retval  HITLS_REC_NORMAL_IO_BUSY I/O busy, the data not sent is cached in the write buffer
+ */
+int32_t RecKtlsWrite(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num);
+
+/**
+ * @brief   Write app data in kTLS mode, the kernel splits the data into records.
+ *
+ * @attention If I/O is busy, the function must be called again with the same data. The progress is kept in
+ *            pendingDataSent of the record context.
+ * @param   ctx [IN] TLS context
+ * @param   iov [IN] Segments of the data to be written
+ * @param   iovCnt [IN] Number of the segments
+ * @param   num [IN] Total length of the segments
+ * @param   writeLen [OUT] Length of the data that has been sent
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_REC_ERR_IO_EXCEPTION I/O error
+ * @retval  HITLS_REC_NORMAL_IO_BUSY I/O busy
+ */
+int32_t RecKtlsWriteMulti(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num, uint32_t *writeLen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HITLS_TLS_FEATURE_KTLS */
+#endif /* REC_KTLS_H */
@@ -36,6 +36,9 @@
 #include "hs.h"
 #include "rec_crypto.h"
 #include "bsl_list.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include "rec_ktls.h"
+#endif
 
 RecConnState *GetReadConnState(const TLS_Ctx *ctx)
 {
@@ -108,13 +111,31 @@ static REC_Type RecCastUintToRecType(TLS_Ctx *ctx, uint8_t value)
 #endif /* HITLS_TLS_PROTO_TLS13 */
     return type;
 }
-#define REC_GetMaxReadSize(ctx) REC_MAX_PLAIN_LENGTH
+static uint32_t RecGetMaxReadSize(const TLS_Ctx *ctx)
+{
+    uint32_t maxReadSize = REC_MAX_PLAIN_LENGTH;
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+    /* The protected records received must not exceed the record_size_limit advertised to the peer, which includes the
+     * content type in TLS1.3 */
+    uint32_t recordSizeLimit = ctx->negotiatedInfo.recordSizeLimit;
+    if (recordSizeLimit != 0 && HS_GetVersion(ctx) == HITLS_VERSION_TLS13) {
+        recordSizeLimit--;
+    }
+    if (recordSizeLimit != 0 && recordSizeLimit < maxReadSize) {
+        maxReadSize = recordSizeLimit;
+    }
+#else
+    (void)ctx;
+#endif
+    return maxReadSize;
+}
+
 static int32_t ProcessDecryptedRecord(TLS_Ctx *ctx, uint32_t dataLen,
     const REC_TextInput *encryptedMsg)
 {
     /* The TLSPlaintext.length MUST NOT exceed 2^14. An endpoint that receives a record that exceeds
     this length MUST terminate the connection with a record_overflow alert */
-    if (dataLen > REC_GetMaxReadSize(ctx)) {
+    if (dataLen > RecGetMaxReadSize(ctx)) {
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID16165, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "TLSPlaintext.length exceeds 2^14", 0, 0, 0, 0);
         return RecordSendAlertMsg(ctx, ALERT_LEVEL_FATAL, ALERT_RECORD_OVERFLOW);
@@ -157,7 +178,15 @@ static int32_t EmptyRecordProcess(TLS_Ctx *ctx, uint8_t type)
     }
 }
 
-static int32_t RecordDecrypt(TLS_Ctx *ctx, RecBuf *decryptBuf, REC_TextInput *encryptedMsg)
+/* An AEAD record that does not fit in the user buffer is decrypted in place, the ciphertext region in the read buffer
+ * becomes the plaintext region. A DTLS record taken from the unprocessed message cache is released right after the
+ * decryption, so it cannot be decrypted in place. */
+static bool IsDecryptInPlace(const RecConnState *state, bool isCachedRecord)
+{
+    return !isCachedRecord && state->suiteInfo != NULL && state->suiteInfo->cipherType == HITLS_AEAD_CIPHER;
+}
+
+static int32_t RecordDecrypt(TLS_Ctx *ctx, RecBuf *decryptBuf, REC_TextInput *encryptedMsg, bool isCachedRecord)
 {
     if (encryptedMsg->textLen == 0) {
         return EmptyRecordProcess(ctx, encryptedMsg->type);
@@ -177,14 +206,20 @@ static int32_t RecordDecrypt(TLS_Ctx *ctx, RecBuf *decryptBuf, REC_TextInput *en
         return RecordSendAlertMsg(ctx, ALERT_LEVEL_FATAL, ALERT_BAD_RECORD_MAC);
     }
     if ((minBufLen > decryptBuf->bufSize || ctx->peekFlag != 0) && minBufLen != 0) {
-        decryptBuf->buf = BSL_SAL_Calloc(minBufLen, sizeof(uint8_t));
-        if (decryptBuf->buf == NULL) {
-            BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17257, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
-                "Calloc fail", 0, 0, 0, 0);
-            return HITLS_MEMALLOC_FAIL;
+        if (IsDecryptInPlace(state, isCachedRecord)) {
+            /* The plaintext is dereferenced before the read buffer is reused */
+            decryptBuf->buf = (uint8_t *)(uintptr_t)&encryptedMsg->text[offset];
+            decryptBuf->isHoldBuffer = false;
+        } else {
+            decryptBuf->buf = BSL_SAL_Calloc(minBufLen, sizeof(uint8_t));
+            if (decryptBuf->buf == NULL) {
+                BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17257, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                    "Calloc fail", 0, 0, 0, 0);
+                return HITLS_MEMALLOC_FAIL;
+            }
+            decryptBuf->isHoldBuffer = true;
         }
         decryptBuf->bufSize = minBufLen;
-        decryptBuf->isHoldBuffer = true;
     }
     decryptBuf->end = decryptBuf->bufSize;
     /* The decrypted record body is in data */
@@ -663,6 +698,7 @@ static int32_t DtlsGetRecord(TLS_Ctx *ctx, REC_Type recordType, RecHdr *hdr, uin
 
 static int32_t DtlsProcessBufList(TLS_Ctx *ctx, REC_Type recordType, RecBufList *bufList, RecBuf *decryptBuf)
 {
+    (void)ctx;
     (void)recordType;
     int32_t ret = RecBufListAddBuffer(bufList, decryptBuf);
     if (ret != HITLS_SUCCESS) {
@@ -671,12 +707,8 @@ static int32_t DtlsProcessBufList(TLS_Ctx *ctx, REC_Type recordType, RecBufList
         }
         return ret;
     }
-    ret = RecDerefBufList(ctx);
-    if (ret != HITLS_SUCCESS) {
-        return ret;
-    }
-
-return HITLS_SUCCESS;
+    /* A record decrypted in place is dereferenced before the next datagram is read into the read buffer */
+    return HITLS_SUCCESS;
 }
 
 /**
@@ -713,7 +745,7 @@ int32_t DtlsRecordRead(TLS_Ctx *ctx, REC_Type recordType, uint8_t *data, uint32_
     REC_TextInput cryptMsg = {0};
     GenerateCryptMsg(ctx, &hdr, recordBody, &cryptMsg);
     RecBuf decryptBuf = { .buf = data, .bufSize = bufSize };
-    ret = RecordDecrypt(ctx, &decryptBuf, &cryptMsg);
+    ret = RecordDecrypt(ctx, &decryptBuf, &cryptMsg, cachRecord != NULL);
     BSL_SAL_FREE(cachRecord);
     if (ret != HITLS_SUCCESS) {
         return ret;
@@ -999,6 +1031,76 @@ int32_t RecordDecryptPrepare(TLS_Ctx *ctx, uint16_t version, REC_Type recordType
     return HITLS_SUCCESS;
 }
 
+#ifdef HITLS_TLS_FEATURE_KTLS
+/* The records were verified by the kernel, so only the plaintext and its record type are read. The plaintext of app
+ * data is read into the user buffer directly if any record fits in it. */
+static int32_t KtlsRecordRead(TLS_Ctx *ctx, REC_Type recordType, uint8_t *data, uint32_t *readLen, uint32_t num)
+{
+    RecBuf *inBuf = ctx->recCtx->inBuf;
+    bool isDirect = (recordType == REC_TYPE_APP) && (ctx->peekFlag == 0) && (num >= REC_MAX_PLAIN_LENGTH);
+    if (!isDirect) {
+        (void)RecDerefBufList(ctx);
+    }
+#ifdef HITLS_TLS_FEATURE_FLIGHT
+    BSL_UIO *uio = ctx->rUio;
+#else
+    BSL_UIO *uio = ctx->uio;
+#endif
+    RecBuf msgBuf = {0};
+    msgBuf.buf = isDirect ? data : inBuf->buf;
+    msgBuf.bufSize = isDirect ? num : inBuf->bufSize;
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_READING;
+#endif
+    int32_t ret = BSL_UIO_Read(uio, msgBuf.buf, msgBuf.bufSize, &msgBuf.end);
+    if (ret != BSL_SUCCESS) {
+        if (ret == BSL_UIO_IO_EOF) {
+            return HITLS_REC_NORMAL_IO_EOF;
+        }
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17378, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Fail to call BSL_UIO_Read in kernel tls mode: [%d]", ret, 0, 0, 0);
+        return HITLS_REC_ERR_IO_EXCEPTION;
+    }
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_NOTHING;
+#endif
+    if (msgBuf.end == 0) {
+        return HITLS_REC_NORMAL_RECV_BUF_EMPTY;
+    }
+    uint8_t type = REC_TYPE_APP;
+    (void)BSL_UIO_Ctrl(uio, BSL_UIO_TCP_GET_KTLS_RECORD_TYPE, (int32_t)sizeof(type), &type);
+    RecClearAlertCount(ctx, type);
+    if (type != recordType) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17379, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
+            "expect type %d, receive type %d", recordType, type, 0, 0);
+        if (isDirect) {
+            /* The user buffer cannot be cached */
+            uint8_t *msg = BSL_SAL_Dump(data, msgBuf.end);
+            if (msg == NULL) {
+                BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17380, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+                    "Dump fail", 0, 0, 0, 0);
+                return HITLS_MEMALLOC_FAIL;
+            }
+            msgBuf.buf = msg;
+            msgBuf.bufSize = msgBuf.end;
+            msgBuf.isHoldBuffer = true;
+        }
+        return RecordUnexpectedMsg(ctx, &msgBuf, (REC_Type)type);
+    }
+    if (isDirect) {
+        *readLen = msgBuf.end;
+        return HITLS_SUCCESS;
+    }
+    /* The plaintext stays in the read buffer and is dereferenced before the read buffer is reused */
+    RecBufList *bufList = (recordType == REC_TYPE_HANDSHAKE) ? ctx->recCtx->hsRecList : ctx->recCtx->appRecList;
+    ret = RecBufListAddBuffer(bufList, &msgBuf);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    return RecBufListGetBuffer(bufList, data, num, readLen, (ctx->peekFlag != 0 && (recordType == REC_TYPE_APP)));
+}
+#endif /* HITLS_TLS_FEATURE_KTLS */
+
 /**
  * @brief Read a record in the TLS protocol.
  * @attention: Handle record and handle transporting state to receive unexpected record type messages
@@ -1021,6 +1123,12 @@ int32_t TlsRecordRead(TLS_Ctx *ctx, REC_Type recordType, uint8_t *data, uint32_t
     if (!RecBufListEmpty(bufList)) {
         return RecBufListGetBuffer(bufList, data, num, readLen, (ctx->peekFlag != 0 && (recordType == REC_TYPE_APP)));
     }
+#ifdef HITLS_TLS_FEATURE_KTLS
+    RecKtlsTryEnableRecv(ctx);
+    if (ctx->recCtx->isKtlsRecv) {
+        return KtlsRecordRead(ctx, recordType, data, readLen, num);
+    }
+#endif
     REC_TextInput encryptedMsg = { 0 };
     int32_t ret = RecordDecryptPrepare(ctx, ctx->negotiatedInfo.version, recordType, &encryptedMsg);
     if (ret != HITLS_SUCCESS) {
@@ -1029,7 +1137,7 @@ int32_t TlsRecordRead(TLS_Ctx *ctx, REC_Type recordType, uint8_t *data, uint32_t
     RecBuf decryptBuf = {0};
     decryptBuf.buf = data;
     decryptBuf.bufSize = num;
-    ret = RecordDecrypt(ctx, &decryptBuf, &encryptedMsg);
+    ret = RecordDecrypt(ctx, &decryptBuf, &encryptedMsg, false);
     if (ret != HITLS_SUCCESS) {
         return ret;
     }
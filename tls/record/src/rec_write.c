@@ -33,6 +33,9 @@
 #endif
 #include "hs.h"
 #include "rec_crypto.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include "rec_ktls.h"
+#endif
 
 
 RecConnState *GetWriteConnState(const TLS_Ctx *ctx)
@@ -42,6 +45,40 @@ RecConnState *GetWriteConnState(const TLS_Ctx *ctx)
     return recordCtx->writeStates.currentState;
 }
 
+uint32_t RecGetWritePlainOffset(const TLS_Ctx *ctx)
+{
+#ifdef HITLS_TLS_FEATURE_KTLS
+    /* The kernel builds the records from the plaintext */
+    if (ctx->recCtx->isKtlsSend) {
+        return 0;
+    }
+#endif
+    RecConnState *state = GetWriteConnState(ctx);
+    uint32_t headerLen =
+#ifdef HITLS_TLS_PROTO_DTLS12
+        IS_SUPPORT_DATAGRAM(ctx->config.tlsConfig.originVersionMask) ? REC_DTLS_RECORD_HEADER_LEN :
+#endif
+        REC_TLS_RECORD_HEADER_LEN;
+    return headerLen + ((state->suiteInfo == NULL) ? 0 : state->suiteInfo->recordIvLength);
+}
+
+void RecGatherData(const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t offset, uint8_t *out, uint32_t len)
+{
+    uint32_t copied = 0;
+    for (uint32_t i = 0; i < iovCnt && copied < len; i++) {
+        if (offset >= iov[i].len) {
+            /* Skip the segments that have been written */
+            offset -= iov[i].len;
+            continue;
+        }
+        uint32_t copyLen = iov[i].len - offset;
+        copyLen = (copyLen > len - copied) ? (len - copied) : copyLen;
+        (void)memcpy_s(&out[copied], len - copied, (const uint8_t *)iov[i].base + offset, copyLen);
+        copied += copyLen;
+        offset = 0;
+    }
+}
+
 static void OutbufUpdate(uint32_t *start, uint32_t startvalue, uint32_t *end, uint32_t endvalue)
 {
     /** Commit the record to be written */
@@ -327,17 +364,6 @@ static inline void TlsRecordHeaderPack(uint8_t *outBuf, REC_Type recordType, uin
     BSL_Uint16ToByte((uint16_t)cipherTextLen, &outBuf[REC_TLS_RECORD_LENGTH_OFFSET]);
 }
 
-static int32_t SendRecord(TLS_Ctx *ctx, RecCtx *recordCtx, RecConnState *state, uint64_t seq)
-{
-    int32_t ret = StreamWrite(ctx, recordCtx->outBuf);
-    if (ret != HITLS_SUCCESS) {
-        return ret;
-    }
-
-    /** Add the record sequence */
-    RecConnSetSeqNum(state, seq + 1);
-    return HITLS_SUCCESS;
-}
 static int32_t SequenceCompare(RecConnState *state, uint64_t value)
 {
     if (state->isWrapped == true) {
@@ -352,14 +378,14 @@ static int32_t SequenceCompare(RecConnState *state, uint64_t value)
     return HITLS_SUCCESS;
 }
 
-static int32_t LengthCheck(uint32_t ciphertextLen, const uint32_t outBufLen, RecBuf *writeBuf)
+static int32_t LengthCheck(uint32_t ciphertextLen, const uint32_t outBufLen, uint32_t bufLen)
 {
     if (ciphertextLen == 0) {
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15671, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "Record write: cipherTextLen(0) error.", 0, 0, 0, 0);
         return HITLS_INTERNAL_EXCEPTION;
     }
-    if (outBufLen > writeBuf->bufSize) {
+    if (outBufLen > bufLen) {
         BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_BUFFER_NOT_ENOUGH);
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15672, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "Record write: buffer is not enough.", 0, 0, 0, 0);
@@ -367,69 +393,269 @@ static int32_t LengthCheck(uint32_t ciphertextLen, const uint32_t outBufLen, Rec
     }
     return HITLS_SUCCESS;
 }
-static const uint8_t *GetPlainMsgData(RecordPlaintext *recPlaintext, const uint8_t *data)
+
+static bool IsDynamicRecordSize(const TLS_Ctx *ctx)
 {
-    (void)recPlaintext;
-    return
-#ifdef HITLS_TLS_PROTO_TLS13
-        recPlaintext->isTlsInnerPlaintext ? recPlaintext->plainData :
+#ifdef HITLS_TLS_FEATURE_KTLS
+    /* The kernel splits the data into records */
+    if (ctx->recCtx->isKtlsSend) {
+        return false;
+    }
 #endif
-        data;
+    return !IS_SUPPORT_DATAGRAM(ctx->config.tlsConfig.originVersionMask) &&
+        (ctx->config.tlsConfig.modeSupport & HITLS_MODE_DYNAMIC_RECORD_SIZE) != 0;
 }
-// Write a record in the TLS protocol, serialize a record message, and send the message
-int32_t TlsRecordWrite(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num)
+
+/* Number of app records sent since the connection was last idle */
+static uint32_t GetDynamicRecordNum(const RecCtx *recCtx, BslUnixTime now)
+{
+    if (now - recCtx->dynLastWriteTime >= REC_DYNAMIC_IDLE_TIMEOUT) {
+        return 0;
+    }
+    return recCtx->dynRecordNum;
+}
+
+uint32_t RecGetDynamicWriteSize(const TLS_Ctx *ctx, uint32_t maxWriteSize)
+{
+    if (!IsDynamicRecordSize(ctx)) {
+        return maxWriteSize;
+    }
+    /* The first record after idle fits in one TCP segment, and each following record grows by one segment, so that
+     * the peer can process the data before the congestion window opens */
+    uint32_t recordNum = GetDynamicRecordNum(ctx->recCtx, BSL_SAL_CurrentSysTimeGet());
+    if (recordNum >= maxWriteSize / REC_DYNAMIC_RECORD_SIZE) {
+        return maxWriteSize;
+    }
+    return REC_DYNAMIC_RECORD_SIZE * (recordNum + 1);
+}
+
+static void DynamicRecordSent(TLS_Ctx *ctx)
+{
+    if (!IsDynamicRecordSize(ctx)) {
+        return;
+    }
+    RecCtx *recCtx = ctx->recCtx;
+    BslUnixTime now = BSL_SAL_CurrentSysTimeGet();
+    uint32_t recordNum = GetDynamicRecordNum(recCtx, now);
+    /* Saturate the number, records of the maximum length are sent once it reaches maxWriteSize / 1369 */
+    recCtx->dynRecordNum = (recordNum < REC_MAX_PLAIN_TEXT_LENGTH) ? recordNum + 1 : recordNum;
+    recCtx->dynLastWriteTime = now;
+}
+
+/* Serialize the header and plaintext of a record at the offset of the write buffer and prepare it for encryption.
+ * The sequence number of the record is the current one of the write state */
+static int32_t TlsRecordPackPlain(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num,
+    uint32_t bufOffset, RecBatchRecord *record)
 {
     RecBuf *writeBuf = ctx->recCtx->outBuf;
     RecConnState *state = GetWriteConnState(ctx);
     RecordPlaintext recPlaintext = {0};
-    REC_TextInput plainMsg = {0};
     int32_t ret = SequenceCompare(state, REC_TLS_SN_MAX_VALUE);
     if (ret != HITLS_SUCCESS) {
         return ret;
     }
-    /* Check whether the cache exists */
-    if (writeBuf->end > writeBuf->start) {
-        return SendRecord(ctx, ctx->recCtx, state, state->seq);
-    }
     const RecCryptoFunc *funcs = RecGetCryptoFuncs(state->suiteInfo);
-    ret = funcs->encryptPreProcess(ctx, recordType, data, num, &recPlaintext);
+    ret = funcs->encryptPreProcess(ctx, recordType, num, &recPlaintext);
     if (ret != HITLS_SUCCESS) {
         BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17281, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
             "encryptPreProcess fail", 0, 0, 0, 0);
         return ret;
     }
 
+    uint8_t *recBuf = &writeBuf->buf[bufOffset];
+    uint32_t recBufLen = writeBuf->bufSize - bufOffset;
     uint32_t ciphertextLen = funcs->calCiphertextLen(ctx, state->suiteInfo, recPlaintext.plainLen, false);
     const uint32_t outBufLen = REC_TLS_RECORD_HEADER_LEN + ciphertextLen;
-    ret = LengthCheck(ciphertextLen, outBufLen, writeBuf);
+    ret = LengthCheck(ciphertextLen, outBufLen, recBufLen);
     if (ret != HITLS_SUCCESS) {
-        BSL_SAL_FREE(recPlaintext.plainData);
         return ret;
     }
-    /* If the value is not tls13, use the input parameter data */
-    const uint8_t *plainMsgData = GetPlainMsgData(&recPlaintext, data);
-    (void)TlsPlainMsgGenerate(&plainMsg, ctx, recPlaintext.recordType, plainMsgData, recPlaintext.plainLen);
-    (void)TlsRecordHeaderPack(writeBuf->buf, recPlaintext.recordType, plainMsg.version, ciphertextLen);
+    const uint8_t *plainMsgData = data;
+#ifdef HITLS_TLS_PROTO_TLS13
+    if (recPlaintext.isTlsInnerPlaintext) {
+        /* The TLSInnerPlaintext is built at the position of the record body in the write buffer and encrypted in
+         * place, so that no intermediate buffer is needed */
+        uint32_t bodyOffset = REC_TLS_RECORD_HEADER_LEN + state->suiteInfo->recordIvLength;
+        uint8_t *innerPlaintext = &recBuf[bodyOffset];
+        ret = RecPackInnerPlaintext(&recPlaintext, recordType, data, num, innerPlaintext, recBufLen - bodyOffset);
+        if (ret != HITLS_SUCCESS) {
+            return ret;
+        }
+        plainMsgData = innerPlaintext;
+    }
+#endif
+    (void)TlsPlainMsgGenerate(&record->plainMsg, ctx, recPlaintext.recordType, plainMsgData, recPlaintext.plainLen);
+    (void)TlsRecordHeaderPack(recBuf, recPlaintext.recordType, record->plainMsg.version, ciphertextLen);
+    record->cipherText = recBuf + REC_TLS_RECORD_HEADER_LEN;
+    record->cipherTextLen = ciphertextLen;
+    if (recordType == REC_TYPE_APP) {
+        DynamicRecordSent(ctx);
+    }
 
-    ret = CheckEncryptionLimits(ctx, state);
+    return CheckEncryptionLimits(ctx, state);
+}
+
+/* Serialize a record behind the data cached in the write buffer and add the record sequence. The sequence number is
+ * consumed once the record is encrypted, so the records cached in the write buffer only need to be flushed */
+static int32_t TlsRecordPack(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num)
+{
+    RecBuf *writeBuf = ctx->recCtx->outBuf;
+    RecConnState *state = GetWriteConnState(ctx);
+    RecBatchRecord record = {0};
+    int32_t ret = TlsRecordPackPlain(ctx, recordType, data, num, writeBuf->end, &record);
     if (ret != HITLS_SUCCESS) {
-        BSL_SAL_FREE(recPlaintext.plainData);
         return ret;
     }
 
     /** Encrypt the record body */
-    ret = RecConnEncrypt(ctx, state, &plainMsg, writeBuf->buf + REC_TLS_RECORD_HEADER_LEN, ciphertextLen);
-    BSL_SAL_FREE(recPlaintext.plainData);
+    ret = RecConnEncrypt(ctx, state, &record.plainMsg, record.cipherText, record.cipherTextLen);
     if (ret != HITLS_SUCCESS) {
         return ret;
     }
 
 #ifdef HITLS_TLS_FEATURE_INDICATOR
-    INDICATOR_MessageIndicate(1, recordType, RECORD_HEADER, writeBuf->buf, REC_TLS_RECORD_HEADER_LEN, ctx,
-                              ctx->config.tlsConfig.msgArg);
+    INDICATOR_MessageIndicate(1, recordType, RECORD_HEADER, &writeBuf->buf[writeBuf->end], REC_TLS_RECORD_HEADER_LEN,
+                              ctx, ctx->config.tlsConfig.msgArg);
+#endif
+    OutbufUpdate(&writeBuf->start, writeBuf->start, &writeBuf->end,
+        writeBuf->end + REC_TLS_RECORD_HEADER_LEN + record.cipherTextLen);
+
+    /** Add the record sequence */
+    RecConnSetSeqNum(state, state->seq + 1);
+    return HITLS_SUCCESS;
+}
+
+// Write a record in the TLS protocol, serialize a record message, and send the message
+int32_t TlsRecordWrite(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t num)
+{
+#ifdef HITLS_TLS_FEATURE_KTLS
+    if (ctx->recCtx->isKtlsSend) {
+        return RecKtlsWrite(ctx, recordType, data, num);
+    }
 #endif
-    OutbufUpdate(&writeBuf->start, 0, &writeBuf->end, outBufLen);
+    RecBuf *writeBuf = ctx->recCtx->outBuf;
+    /* Check whether the cache exists */
+    if (writeBuf->end > writeBuf->start) {
+        return StreamWrite(ctx, writeBuf);
+    }
+    int32_t ret = TlsRecordPack(ctx, recordType, data, num);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    return StreamWrite(ctx, writeBuf);
+}
 
-    return SendRecord(ctx, ctx->recCtx, state, state->seq);
+static int32_t TlsRecordEncryptBatch(TLS_Ctx *ctx, RecConnState *state, const RecBatchRecord *records, uint32_t num)
+{
+    const RecCryptoFunc *funcs = RecGetCryptoFuncs(state->suiteInfo);
+    if (funcs->encryptBatch != NULL) {
+        return funcs->encryptBatch(ctx, state, records, num);
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        int32_t ret = funcs->encryt(ctx, state, &records[i].plainMsg, records[i].cipherText,
+            records[i].cipherTextLen);
+        if (ret != HITLS_SUCCESS) {
+            return ret;
+        }
+    }
+    return HITLS_SUCCESS;
+}
+
+/* Pack up to REC_MAX_WRITE_BATCH_RECORD_NUM application records back-to-back behind the write buffer and encrypt them
+ * together. The records are committed to the write buffer only if all of them are encrypted */
+static int32_t TlsRecordPackMulti(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num,
+    uint32_t maxWriteSize, uint32_t recordBufSize)
+{
+    RecCtx *recCtx = ctx->recCtx;
+    RecBuf *writeBuf = recCtx->outBuf;
+    RecConnState *state = GetWriteConnState(ctx);
+    RecBatchRecord records[REC_MAX_WRITE_BATCH_RECORD_NUM];
+    uint32_t recordNum = 0;
+    uint32_t packEnd = writeBuf->end;
+    uint32_t packedLen = 0;
+    uint64_t firstSeq = state->seq;
+    int32_t ret = HITLS_SUCCESS;
+    while (recCtx->pendingDataPacked + packedLen < num && recordNum < REC_MAX_WRITE_BATCH_RECORD_NUM &&
+        (packEnd == 0 || writeBuf->bufSize - packEnd >= recordBufSize)) {
+        uint32_t offset = recCtx->pendingDataPacked + packedLen;
+        uint32_t fragmentLen = num - offset;
+        uint32_t recordSize = RecGetDynamicWriteSize(ctx, maxWriteSize);
+        fragmentLen = (fragmentLen > recordSize) ? recordSize : fragmentLen;
+        const uint8_t *fragment = (const uint8_t *)iov[0].base + offset;
+        if (iovCnt > 1) {
+            /* Gather the segments at the position of the record body, which is then encrypted in place */
+            uint8_t *recordBody = &writeBuf->buf[packEnd + RecGetWritePlainOffset(ctx)];
+            RecGatherData(iov, iovCnt, offset, recordBody, fragmentLen);
+            fragment = recordBody;
+        }
+        ret = TlsRecordPackPlain(ctx, REC_TYPE_APP, fragment, fragmentLen, packEnd, &records[recordNum]);
+        if (ret != HITLS_SUCCESS) {
+            break;
+        }
+        packEnd += REC_TLS_RECORD_HEADER_LEN + records[recordNum].cipherTextLen;
+        packedLen += fragmentLen;
+        recordNum++;
+        /* The next record takes the next sequence number */
+        RecConnSetSeqNum(state, state->seq + 1);
+    }
+    if (ret == HITLS_SUCCESS && recordNum > 0) {
+        ret = TlsRecordEncryptBatch(ctx, state, records, recordNum);
+    }
+    if (ret != HITLS_SUCCESS) {
+        RecConnSetSeqNum(state, firstSeq);
+        return ret;
+    }
+#ifdef HITLS_TLS_FEATURE_INDICATOR
+    for (uint32_t i = 0; i < recordNum; i++) {
+        INDICATOR_MessageIndicate(1, REC_TYPE_APP, RECORD_HEADER, records[i].cipherText - REC_TLS_RECORD_HEADER_LEN,
+            REC_TLS_RECORD_HEADER_LEN, ctx, ctx->config.tlsConfig.msgArg);
+    }
+#endif
+    OutbufUpdate(&writeBuf->start, writeBuf->start, &writeBuf->end, packEnd);
+    recCtx->pendingDataPacked += packedLen;
+    return HITLS_SUCCESS;
+}
+
+int32_t TlsRecordWriteMulti(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num, uint32_t *writeLen)
+{
+#ifdef HITLS_TLS_FEATURE_KTLS
+    if (ctx->recCtx->isKtlsSend) {
+        return RecKtlsWriteMulti(ctx, iov, iovCnt, num, writeLen);
+    }
+#endif
+    RecCtx *recCtx = ctx->recCtx;
+    RecBuf *writeBuf = recCtx->outBuf;
+    uint32_t maxWriteSize = 0;
+    int32_t ret = REC_GetMaxWriteSize(ctx, &maxWriteSize);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+    /* Space reserved for one record of the maximum length */
+    uint32_t recordBufSize = RecGetInitBufferSize(ctx, false);
+    do {
+        /* Flush the records packed in the write buffer by one I/O write */
+        if (writeBuf->end > writeBuf->start) {
+            ret = StreamWrite(ctx, writeBuf);
+            if (ret != HITLS_SUCCESS) {
+                *writeLen = recCtx->pendingDataSent;
+                return ret;
+            }
+        }
+        recCtx->pendingDataSent = recCtx->pendingDataPacked;
+        /* Pack the records until the data is exhausted or the write buffer is full */
+        while (recCtx->pendingDataPacked < num &&
+            (writeBuf->end == 0 || writeBuf->bufSize - writeBuf->end >= recordBufSize)) {
+            ret = TlsRecordPackMulti(ctx, iov, iovCnt, num, maxWriteSize, recordBufSize);
+            if (ret != HITLS_SUCCESS) {
+                *writeLen = recCtx->pendingDataSent;
+                return ret;
+            }
+        }
+    } while (writeBuf->end > writeBuf->start);
+
+    *writeLen = num;
+    recCtx->pendingDataPacked = 0;
+    recCtx->pendingDataSent = 0;
+    return HITLS_SUCCESS;
 }
 #endif /* HITLS_TLS_PROTO_TLS */
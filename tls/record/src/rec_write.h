@@ -39,6 +39,36 @@ extern "C" {
  */
 int32_t TlsRecordWrite(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data, uint32_t plainLen);
 
+/**
+ * @brief   Write app data as multiple records in TLS. The records are packed back-to-back into the write buffer and
+ *          flushed by one I/O write per batch.
+ *
+ * @attention If I/O is busy, the packed records are cached, and the function must be called again with the same data.
+ *            The progress is kept in pendingDataPacked and pendingDataSent of the record context.
+ * @param   ctx [IN] TLS context
+ * @param   iov [IN] Segments of the data to be written
+ * @param   iovCnt [IN] Number of the segments
+ * @param   num [IN] Total length of the segments
+ * @param   writeLen [OUT] Length of the data whose records have been sent
+ *
+ * @retval  HITLS_SUCCESS
+ * @retval  HITLS_REC_ERR_IO_EXCEPTION I/O error
+ * @retval  HITLS_REC_NORMAL_IO_BUSY I/O busy
+ * @retval  HITLS_REC_ERR_SN_WRAPPING Sequence number wrap
+ */
+int32_t TlsRecordWriteMulti(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num, uint32_t *writeLen);
+
+/**
+ * @brief   Obtain the plaintext length of the next app record in TLS, see HITLS_MODE_DYNAMIC_RECORD_SIZE
+ *
+ * @param   ctx [IN] TLS context
+ * @param   maxWriteSize [IN] Maximum plaintext length of a record
+ *
+ * @return  maxWriteSize if the mode is not set or the connection has sent enough records since it was idle,
+ *          otherwise a multiple of one TCP segment
+ */
+uint32_t RecGetDynamicWriteSize(const TLS_Ctx *ctx, uint32_t maxWriteSize);
+
 #ifdef HITLS_TLS_PROTO_DTLS12
 
 /**
@@ -58,6 +88,28 @@ int32_t DtlsRecordWrite(TLS_Ctx *ctx, REC_Type recordType, const uint8_t *data,
 
 #endif
 
+/**
+ * @brief   Obtain the offset of the record plaintext in the write buffer, that is, the position where the plaintext
+ *          can be encrypted in place
+ *
+ * @param   ctx [IN] TLS context
+ *
+ * @return  Offset of the plaintext
+ */
+uint32_t RecGetWritePlainOffset(const TLS_Ctx *ctx);
+
+/**
+ * @brief   Copy the data described by the segments to a contiguous buffer
+ *
+ * @attention The caller ensures that the segments hold at least offset + len bytes and out holds len bytes
+ * @param   iov [IN] Segments of the data
+ * @param   iovCnt [IN] Number of the segments
+ * @param   offset [IN] Offset of the data to be copied
+ * @param   out [OUT] Destination buffer
+ * @param   len [IN] Length to be copied
+ */
+void RecGatherData(const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t offset, uint8_t *out, uint32_t len);
+
 /**
  * @brief   Write data to the UIO of the TLS context
  *
@@ -29,6 +29,9 @@
 #include "hs.h"
 #include "alert.h"
 #include "record.h"
+#ifdef HITLS_TLS_FEATURE_KTLS
+#include "rec_ktls.h"
+#endif
 
 // Release RecStatesSuite
 static void RecConnStatesDeinit(RecCtx *recordCtx)
@@ -300,6 +303,29 @@ void REC_DeInit(TLS_Ctx *ctx)
     return;
 }
 
+int32_t REC_PeekAppBuffer(const TLS_Ctx *ctx, const uint8_t **buf, uint32_t *len)
+{
+    if ((ctx == NULL) || (ctx->recCtx == NULL) || (buf == NULL) || (len == NULL)) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17370, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record peek: input null pointer.", 0, 0, 0, 0);
+        BSL_ERR_PUSH_ERROR(HITLS_NULL_INPUT);
+        return HITLS_NULL_INPUT;
+    }
+    uint8_t *data = NULL;
+    int32_t ret = RecBufListPeekBuffer(ctx->recCtx->appRecList, &data, len);
+    *buf = data;
+    return ret;
+}
+
+int32_t REC_ConsumeAppBuffer(TLS_Ctx *ctx, uint32_t len)
+{
+    if ((ctx == NULL) || (ctx->recCtx == NULL)) {
+        BSL_ERR_PUSH_ERROR(HITLS_NULL_INPUT);
+        return HITLS_NULL_INPUT;
+    }
+    return RecBufListConsumeBuffer(ctx->recCtx->appRecList, len);
+}
+
 bool REC_ReadHasPending(const TLS_Ctx *ctx)
 {
     if ((ctx == NULL) || (ctx->recCtx == NULL)) {
@@ -512,6 +538,14 @@ int32_t REC_ActivePendingState(TLS_Ctx *ctx, bool isOut)
     states->pendingState = NULL;
     /* Set the sequence number to 0 */
     RecConnSetSeqNum(states->currentState, 0);
+#ifdef HITLS_TLS_FEATURE_RECORD_SIZE_LIMIT
+    /* The negotiated record_size_limit applies to the records protected by the new keys */
+    if (isOut) {
+        ctx->negotiatedInfo.peerRecordSizeLimit = ctx->negotiatedInfo.pendingPeerRecordSizeLimit;
+    } else {
+        ctx->negotiatedInfo.recordSizeLimit = ctx->negotiatedInfo.pendingRecordSizeLimit;
+    }
+#endif
 
 #ifdef HITLS_TLS_PROTO_DTLS12
     if (IS_SUPPORT_DATAGRAM(ctx->config.tlsConfig.originVersionMask)) {
@@ -527,6 +561,12 @@ int32_t REC_ActivePendingState(TLS_Ctx *ctx, bool isOut)
         }
     }
 #endif /* HITLS_TLS_PROTO_DTLS12 */
+#ifdef HITLS_TLS_FEATURE_KTLS
+    int32_t ret = RecKtlsUpdateKey(ctx, isOut);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+#endif
 
     BSL_LOG_BINLOG_FIXLEN(BINLOG_ID15544, BSL_LOG_LEVEL_INFO, BSL_LOG_BINLOG_TYPE_RUN,
         "Record: active pending state.", 0, 0, 0, 0);
@@ -542,7 +582,7 @@ static uint32_t REC_GetRecordSizeLimitWriteLen(const TLS_Ctx *ctx)
 #else
     REC_MAX_PLAIN_TEXT_LENGTH;
 #endif
-    if (ctx->negotiatedInfo.recordSizeLimit != 0 && ctx->negotiatedInfo.peerRecordSizeLimit <= defaultLen) {
+    if (ctx->negotiatedInfo.peerRecordSizeLimit != 0 && ctx->negotiatedInfo.peerRecordSizeLimit <= defaultLen) {
         defaultLen = ctx->negotiatedInfo.peerRecordSizeLimit;
         if (ctx->negotiatedInfo.version == HITLS_VERSION_TLS13) {
             defaultLen--;
@@ -551,14 +591,76 @@ static uint32_t REC_GetRecordSizeLimitWriteLen(const TLS_Ctx *ctx)
     return defaultLen;
 }
 
+int32_t REC_Writev(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num)
+{
+    if ((ctx == NULL) || (ctx->recCtx == NULL) || (iov == NULL) || (iovCnt == 0)) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17366, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record write: input null pointer.", 0, 0, 0, 0);
+        BSL_ERR_PUSH_ERROR(HITLS_NULL_INPUT);
+        return HITLS_NULL_INPUT;
+    }
+    RecBuf *outBuf = ctx->recCtx->outBuf;
+    uint32_t plainOffset = RecGetWritePlainOffset(ctx);
+    if (plainOffset > outBuf->bufSize || num > outBuf->bufSize - plainOffset) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17367, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record write: plain length is too long.", 0, 0, 0, 0);
+        BSL_ERR_PUSH_ERROR(HITLS_REC_ERR_TOO_BIG_LENGTH);
+        return HITLS_REC_ERR_TOO_BIG_LENGTH;
+    }
+    uint8_t *plainData = &outBuf->buf[plainOffset];
+    /* If a record is cached, the write only flushes the cached record, and the buffer cannot be overwritten */
+    if (outBuf->end == outBuf->start) {
+        /* Gather the segments at the position of the record body, which is then encrypted in place */
+        RecGatherData(iov, iovCnt, 0, plainData, num);
+    }
+    return ctx->recCtx->recWrite(ctx, REC_TYPE_APP, plainData, num);
+}
+
+#ifdef HITLS_TLS_PROTO_TLS
+bool REC_IsMultiRecordWrite(const TLS_Ctx *ctx)
+{
+    return !IS_SUPPORT_DATAGRAM(ctx->config.tlsConfig.originVersionMask) &&
+        (ctx->config.tlsConfig.modeSupport & HITLS_MODE_MULTI_RECORD_WRITE) != 0;
+}
+
+int32_t REC_WriteMultiRecord(TLS_Ctx *ctx, const HITLS_Iovec *iov, uint32_t iovCnt, uint32_t num,
+    uint32_t *writeLen)
+{
+    if ((ctx == NULL) || (ctx->recCtx == NULL) || (iov == NULL) || (iovCnt == 0) || (writeLen == NULL)) {
+        BSL_LOG_BINLOG_FIXLEN(BINLOG_ID17365, BSL_LOG_LEVEL_ERR, BSL_LOG_BINLOG_TYPE_RUN,
+            "Record write: input null pointer.", 0, 0, 0, 0);
+        BSL_ERR_PUSH_ERROR(HITLS_NULL_INPUT);
+        return HITLS_NULL_INPUT;
+    }
+#ifdef HITLS_TLS_CONFIG_STATE
+    ctx->rwstate = HITLS_NOTHING;
+#endif
+    return TlsRecordWriteMulti(ctx, iov, iovCnt, num, writeLen);
+}
+#endif /* HITLS_TLS_PROTO_TLS */
+
 int32_t REC_RecBufReSet(TLS_Ctx *ctx)
 {
     RecCtx *recCtx = ctx->recCtx;
-    int32_t ret = RecBufResize(recCtx->inBuf, RecGetReadBufferSize(ctx));
+    uint32_t readBufSize = RecGetReadBufferSize(ctx);
+    if (recCtx->inBuf != NULL && recCtx->inBuf->bufSize != readBufSize) {
+        /* The buffered plaintext may still point into the read buffer */
+        int32_t ret = RecDerefBufList(ctx);
+        if (ret != HITLS_SUCCESS) {
+            return ret;
+        }
+    }
+    int32_t ret = RecBufResize(recCtx->inBuf, readBufSize);
     if (ret != HITLS_SUCCESS) {
         return ret;
     }
-    return RecBufResize(recCtx->outBuf, RecGetWriteBufferSize(ctx));
+    uint32_t writeBufSize = RecGetWriteBufferSize(ctx);
+#ifdef HITLS_TLS_PROTO_TLS
+    if (REC_IsMultiRecordWrite(ctx)) {
+        writeBufSize *= REC_MAX_WRITE_BATCH_RECORD_NUM;
+    }
+#endif
+    return RecBufResize(recCtx->outBuf, writeBufSize);
 }
 
 #if defined(HITLS_TLS_PROTO_DTLS12) && defined(HITLS_BSL_UIO_UDP)
@@ -649,6 +751,18 @@ int32_t REC_GetMaxWriteSize(const TLS_Ctx *ctx, uint32_t *len)
     return HITLS_SUCCESS;
 }
 
+int32_t REC_GetMaxAppWriteSize(const TLS_Ctx *ctx, uint32_t *len)
+{
+    int32_t ret = REC_GetMaxWriteSize(ctx, len);
+    if (ret != HITLS_SUCCESS) {
+        return ret;
+    }
+#ifdef HITLS_TLS_PROTO_TLS
+    *len = RecGetDynamicWriteSize(ctx, *len);
+#endif
+    return HITLS_SUCCESS;
+}
+
 #if defined(HITLS_TLS_PROTO_DTLS12) && defined(HITLS_BSL_UIO_UDP)
 int32_t REC_GetMaxDataMtu(const TLS_Ctx *ctx, uint32_t *len)
 {
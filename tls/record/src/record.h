@@ -16,6 +16,7 @@
 #ifndef RECORD_H
 #define RECORD_H
 
+#include "bsl_sal.h"
 #include "tls.h"
 #include "rec.h"
 #include "rec_header.h"
@@ -36,6 +37,13 @@ extern "C" {
 
 #define REC_MAX_AES_GCM_ENCRYPTION_LIMIT 23726566u   /* RFC 8446 5.5 Limits on Key Usage AES-GCM SHOULD under 2^24.5 */
 
+#define REC_MAX_WRITE_BATCH_RECORD_NUM 8u   /* Maximum number of records flushed by one I/O write in multi-record write */
+
+/* Plaintext of an app record that fits in one 1460-byte TCP segment together with the TCP timestamp option, the record
+ * header and the record protection overhead, see HITLS_MODE_DYNAMIC_RECORD_SIZE */
+#define REC_DYNAMIC_RECORD_SIZE 1369u
+#define REC_DYNAMIC_IDLE_TIMEOUT 1          /* Seconds without app records after which the record size is reset */
+
 typedef struct {
     RecConnState *outdatedState;
     RecConnState *currentState;
@@ -78,6 +86,18 @@ typedef struct RecCtx {
     REC_Type unexpectedMsgType;
     uint32_t pendingDataSize;               /* Data length */
     const uint8_t *pendingData;             /* Plain Data content */
+#ifdef HITLS_TLS_PROTO_TLS
+    uint32_t pendingDataPacked;             /* Length of the pending data that has been packed into records */
+    uint32_t pendingDataSent;               /* Length of the pending data whose records have been sent */
+    uint32_t dynRecordNum;                  /* Number of app records sent since the connection was last idle */
+    BslUnixTime dynLastWriteTime;           /* Time when the last app record was sent, in seconds */
+#endif
+#ifdef HITLS_TLS_FEATURE_KTLS
+    bool isKtlsSend;                        /* The records to be sent are protected by the kernel */
+    bool isKtlsRecv;                        /* The records received are verified by the kernel */
+    bool isKtlsRecvPending;                 /* Offload the records received once the read buffer is drained */
+    uint8_t ktlsSendType;                   /* Record type the kernel uses for the data written */
+#endif
 } RecCtx;
 
 